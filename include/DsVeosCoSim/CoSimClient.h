@@ -44,6 +44,18 @@ public:
     virtual void Read(IoSignalId incomingSignalId, uint32_t& length, void* value) const = 0;
     virtual void Read(IoSignalId incomingSignalId, uint32_t& length, const void** value) const = 0;
 
+    virtual void WriteSignals(uint32_t outgoingSignalsCount, const IoSignalWriteValue* outgoingSignals) const = 0;
+    virtual void ReadSignals(uint32_t incomingSignalsCount, IoSignalReadValue* incomingSignals) const = 0;
+
+    // Signal handles are only valid until the client disconnects
+    [[nodiscard]] virtual IoSignalHandle GetIncomingSignalHandle(IoSignalId incomingSignalId) const = 0;
+    [[nodiscard]] virtual IoSignalHandle GetOutgoingSignalHandle(IoSignalId outgoingSignalId) const = 0;
+
+    virtual void WriteFast(IoSignalHandle outgoingSignalHandle, uint32_t length, const void* value) const = 0;
+
+    virtual void ReadFast(IoSignalHandle incomingSignalHandle, uint32_t& length, void* value) const = 0;
+    virtual void ReadFast(IoSignalHandle incomingSignalHandle, uint32_t& length, const void** value) const = 0;
+
     virtual void GetCanControllers(uint32_t* controllersCount, const CanController** controllers) const = 0;
     virtual void GetEthControllers(uint32_t* controllersCount, const EthController** controllers) const = 0;
     virtual void GetLinControllers(uint32_t* controllersCount, const LinController** controllers) const = 0;
@@ -59,6 +71,41 @@ public:
     [[nodiscard]] virtual bool Receive(CanMessage& message) const = 0;
     [[nodiscard]] virtual bool Receive(EthMessage& message) const = 0;
     [[nodiscard]] virtual bool Receive(LinMessage& message) const = 0;
+
+    // Only receive messages of the given controller, so models of different buses can each drain their own controller
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, CanMessage& message) const = 0;
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, EthMessage& message) const = 0;
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, LinMessage& message) const = 0;
+
+    // Transmit the messages in order and return how many of them were queued. Messages for full queues are dropped
+    [[nodiscard]] virtual uint32_t TransmitMany(const CanMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const EthMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const LinMessage* messages, uint32_t count) const = 0;
+
+    // Receive up to maxCount messages and return how many were received
+    [[nodiscard]] virtual uint32_t ReceiveMany(CanMessage* messages, uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(EthMessage* messages, uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(LinMessage* messages, uint32_t maxCount) const = 0;
+
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               CanMessage* messages,
+                                               uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               EthMessage* messages,
+                                               uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               LinMessage* messages,
+                                               uint32_t maxCount) const = 0;
+
+    // Drop received messages of the controller, which match none of the filters. The filters apply until disconnect
+    virtual void SetCanAcceptanceFilter(BusControllerId controllerId,
+                                        const std::vector<BusMessageIdFilter>& filters) const = 0;
+    virtual void SetLinAcceptanceFilter(BusControllerId controllerId,
+                                        const std::vector<BusMessageIdFilter>& filters) const = 0;
+
+    // Latencies of the protocol round trips per command. Can be called from any thread
+    [[nodiscard]] virtual LatencyStatistics GetLatencyStatistics(Command command, LatencyPhase phase) const = 0;
+    virtual void ResetLatencyStatistics() = 0;
 };
 
 std::unique_ptr<CoSimClient> CreateClient();
@@ -16,6 +16,15 @@ struct CoSimServerConfig {
     bool enableRemoteAccess{};
     std::string serverName;
     bool isClientOptional{};
+    uint32_t maxClientCount = 1;
+    // Clients that request it get their next step before their last step is consumed, so a read returns the data
+    // of the step before the last one
+    bool enablePipelinedSteps{};
+    // Remote clients that request it exchange large frames compressed
+    bool enableCompression{};
+    WaitMode waitMode{};
+    uint32_t spinTimeInMicroseconds = DefaultSpinTimeInMicroseconds;
+    TcpSocketOptions tcpSocketOptions{};
     bool startPortMapper{};
     bool registerAtPortMapper = true;
     SimulationTime stepSize{};
@@ -47,18 +56,48 @@ public:
     virtual void Pause(SimulationTime simulationTime) = 0;
     virtual void Continue(SimulationTime simulationTime) = 0;
     virtual SimulationTime Step(SimulationTime simulationTime) = 0;
+    // Runs stepCount steps of the configured step size with one round trip, if all clients support it
+    virtual SimulationTime StepN(SimulationTime simulationTime, uint32_t stepCount) = 0;
 
     virtual void Write(IoSignalId signalId, uint32_t length, const void* value) const = 0;
 
+    // Reads the value sent by the connected client that connected first
     virtual void Read(IoSignalId signalId, uint32_t& length, const void** value) const = 0;
+    // Reads the value sent by the client with the given id. Throws if that client is not connected anymore
+    virtual void Read(uint32_t clientId, IoSignalId signalId, uint32_t& length, const void** value) const = 0;
+
+    virtual void WriteSignals(uint32_t signalsCount, const IoSignalWriteValue* signals) const = 0;
+    // Reads the values sent by the connected client that connected first
+    virtual void ReadSignals(uint32_t signalsCount, IoSignalReadValue* signals) const = 0;
+
+    [[nodiscard]] virtual IoSignalHandle GetIncomingSignalHandle(IoSignalId signalId) const = 0;
+    [[nodiscard]] virtual IoSignalHandle GetOutgoingSignalHandle(IoSignalId signalId) const = 0;
+
+    virtual void WriteFast(IoSignalHandle signalHandle, uint32_t length, const void* value) const = 0;
+
+    // Reads the value sent by the connected client that connected first
+    virtual void ReadFast(IoSignalHandle signalHandle, uint32_t& length, const void** value) const = 0;
 
     [[nodiscard]] virtual bool Transmit(const CanMessage& message) const = 0;
     [[nodiscard]] virtual bool Transmit(const EthMessage& message) const = 0;
     [[nodiscard]] virtual bool Transmit(const LinMessage& message) const = 0;
 
+    // Transmit the messages in order to all clients and return the lowest count of messages queued for a client
+    [[nodiscard]] virtual uint32_t TransmitMany(const CanMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const EthMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const LinMessage* messages, uint32_t count) const = 0;
+
     virtual void BackgroundService() = 0;
 
+    [[nodiscard]] virtual uint32_t GetClientCount() const = 0;
+    // Ids of the connected clients in the order they connected. An id is never reused for another client
+    [[nodiscard]] virtual std::vector<uint32_t> GetClientIds() const = 0;
+
     [[nodiscard]] virtual uint16_t GetLocalPort() const = 0;
+
+    // Latencies of the protocol round trips per command. Can be called from any thread
+    [[nodiscard]] virtual LatencyStatistics GetLatencyStatistics(Command command, LatencyPhase phase) const = 0;
+    virtual void ResetLatencyStatistics() = 0;
 };
 
 std::unique_ptr<CoSimServer> CreateServer();
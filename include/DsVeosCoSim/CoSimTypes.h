@@ -162,10 +162,66 @@ enum class SimulationState {
 [[nodiscard]] std::string ToString(SimulationState simulationState);
 
 enum class Mode {
+    // The server sends the next step before it consumes the response to the previous one
+    PipelinedSteps = 1,
+
+    // The client runs multiple steps for one frame and only reports the state after the last one
+    StepN = 2,
+
+    // Large frames on remote connections are compressed
+    Compression = 4
 };
 
+ENUM_BITMASK_OPS(Mode);
+
 [[nodiscard]] std::string ToString(Mode mode);
 
+enum class WaitMode : uint32_t {
+    // Sleeps in the operating system until data arrives
+    Block,
+
+    // Busy-polls for the spin time, yields for the spin time and only blocks afterwards
+    SpinThenBlock
+};
+
+[[nodiscard]] std::string ToString(WaitMode waitMode);
+
+constexpr uint32_t DefaultSpinTimeInMicroseconds = 100;
+
+// Part of a protocol round trip, for which latency statistics are recorded
+enum class LatencyPhase : uint32_t {
+    // Writing the IO and bus data into a step frame
+    Serialize,
+
+    // Handing a complete frame to the channel
+    Send,
+
+    // Waiting for the next frame of the counterpart. A server sums up the waits for all its clients into one sample
+    Wait,
+
+    // Reading a received frame including the callbacks invoked while reading
+    Deserialize,
+
+    // Simulation callbacks. In polling mode the time between PollCommand and FinishCommand
+    Callback
+};
+
+[[nodiscard]] std::string ToString(LatencyPhase latencyPhase);
+
+// Percentiles have a relative error of at most 1/32
+struct LatencyStatistics {
+    uint64_t count{};
+    std::chrono::nanoseconds minimum{};
+    std::chrono::nanoseconds maximum{};
+    std::chrono::nanoseconds mean{};
+    std::chrono::nanoseconds p50{};
+    std::chrono::nanoseconds p90{};
+    std::chrono::nanoseconds p99{};
+    std::chrono::nanoseconds p999{};
+};
+
+[[nodiscard]] std::string ToString(const LatencyStatistics& statistics);
+
 [[nodiscard]] std::string DataToString(uint8_t* data, size_t dataLength, char separator = 0);
 
 enum class IoSignalId : uint32_t {
@@ -173,6 +229,10 @@ enum class IoSignalId : uint32_t {
 
 [[nodiscard]] std::string ToString(IoSignalId signalId);
 
+// Resolved IO signal, which can be written and read without looking up and validating the signal id again
+enum class IoSignalHandle : uint32_t {
+};
+
 struct IoSignal {
     IoSignalId id{};
     uint32_t length{};
@@ -181,6 +241,18 @@ struct IoSignal {
     const char* name{};
 };
 
+struct IoSignalWriteValue {
+    IoSignalId id{};
+    uint32_t length{};
+    const void* value{};
+};
+
+struct IoSignalReadValue {
+    IoSignalId id{};
+    uint32_t length{};
+    void* value{};
+};
+
 struct IoSignalContainer {
     IoSignalId id{};
     uint32_t length{};
@@ -208,6 +280,12 @@ enum class BusMessageId : uint32_t {
 
 [[nodiscard]] std::string ToString(BusMessageId busMessageId);
 
+// Accepts a message, if (id & mask) == (match & mask)
+struct BusMessageIdFilter {
+    uint32_t mask{};
+    uint32_t match{};
+};
+
 enum class CanMessageFlags : uint32_t {
     Loopback = 1,
     Error = 2,
@@ -254,6 +332,9 @@ struct CanMessage {
     const uint8_t* data{};
 
     [[nodiscard]] explicit operator CanMessageContainer() const;
+
+    void CheckMaxLength() const;
+    void CheckFlags() const;
 };
 
 struct CanMessageContainer {
@@ -322,6 +403,8 @@ struct EthMessage {
     const uint8_t* data{};
 
     [[nodiscard]] explicit operator EthMessageContainer() const;
+
+    void CheckMaxLength() const;
 };
 
 struct EthMessageContainer {
@@ -403,6 +486,8 @@ struct LinMessage {
     const uint8_t* data{};
 
     [[nodiscard]] explicit operator LinMessageContainer() const;
+
+    void CheckMaxLength() const;
 };
 
 struct LinMessageContainer {
@@ -456,12 +541,34 @@ struct Callbacks {
     EthMessageReceivedCallback ethMessageReceivedCallback;
 };
 
+// Tuning of the TCP sockets of remote connections. Zero and -1 keep the default of the operating system
+struct TcpSocketOptions {
+    uint32_t sendBufferSize{};
+    uint32_t receiveBufferSize{};
+    // Acknowledges received data immediately instead of delaying the acknowledgement (Linux only)
+    bool enableQuickAck{};
+    // Polls the network device for incoming data before a receive blocks (Linux only)
+    uint32_t busyPollTimeInMicroseconds{};
+    // Closes the connection if sent data is not acknowledged within this time (Linux only)
+    uint32_t userTimeoutInMilliseconds{};
+    // CPU, which should process the packets of the socket (Linux only)
+    int32_t cpuAffinity = -1;
+};
+
 struct ConnectConfig {
     std::string remoteIpAddress;
     std::string serverName;
     std::string clientName;
     uint16_t remotePort{};
     uint16_t localPort{};
+    bool enablePipelinedSteps{};
+    // The client does not need to interact with the server on every step
+    bool enableStepN{};
+    // Trades CPU time for bandwidth on remote connections, if the server enables it as well
+    bool enableCompression{};
+    WaitMode waitMode{};
+    uint32_t spinTimeInMicroseconds = DefaultSpinTimeInMicroseconds;
+    TcpSocketOptions tcpSocketOptions{};
 };
 
 }  // namespace DsVeosCoSim
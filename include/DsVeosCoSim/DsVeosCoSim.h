@@ -87,6 +87,11 @@ typedef void* DsVeosCoSim_Handle;
  */
 typedef uint32_t DsVeosCoSim_IoSignalId;
 
+/**
+ * \brief Represents a resolved IO signal, which is only valid until the client disconnects.
+ */
+typedef uint32_t DsVeosCoSim_IoSignalHandle;
+
 /**
  * \brief Represents a bus controller id.
  */
@@ -173,9 +178,92 @@ typedef enum DsVeosCoSim_Command {
      */
     DsVeosCoSim_Command_Continue,
 
+    /**
+     * \brief Ping command. Only used for querying latency statistics.
+     */
+    DsVeosCoSim_Command_Ping = 8,
+
     DsVeosCoSim_Command_INT_MAX_SENTINEL_DO_NOT_USE_ = INT32_MAX
 } DsVeosCoSim_Command;
 
+/**
+ * \brief Represents a part of a protocol round trip, for which latency statistics are recorded.
+ */
+typedef enum DsVeosCoSim_LatencyPhase {
+    /**
+     * \brief Writing the IO and bus data into a step frame.
+     */
+    DsVeosCoSim_LatencyPhase_Serialize,
+
+    /**
+     * \brief Handing a complete frame to the channel.
+     */
+    DsVeosCoSim_LatencyPhase_Send,
+
+    /**
+     * \brief Waiting for the next frame of the dSPACE VEOS CoSim server.
+     */
+    DsVeosCoSim_LatencyPhase_Wait,
+
+    /**
+     * \brief Reading a received frame including the callbacks invoked while reading.
+     */
+    DsVeosCoSim_LatencyPhase_Deserialize,
+
+    /**
+     * \brief Simulation callbacks. In polling mode the time between polling and finishing a command.
+     */
+    DsVeosCoSim_LatencyPhase_Callback,
+
+    DsVeosCoSim_LatencyPhase_INT_MAX_SENTINEL_DO_NOT_USE_ = INT32_MAX
+} DsVeosCoSim_LatencyPhase;
+
+/**
+ * \brief Represents the latency statistics of one phase of a command. All latencies are in nanoseconds.
+ *        Percentiles have a relative error of at most 1/32.
+ */
+typedef struct DsVeosCoSim_LatencyStatistics {
+    /**
+     * \brief The number of recorded latencies.
+     */
+    uint64_t count;
+
+    /**
+     * \brief The minimum latency.
+     */
+    int64_t minimum;
+
+    /**
+     * \brief The maximum latency.
+     */
+    int64_t maximum;
+
+    /**
+     * \brief The mean latency.
+     */
+    int64_t mean;
+
+    /**
+     * \brief The 50th percentile.
+     */
+    int64_t p50;
+
+    /**
+     * \brief The 90th percentile.
+     */
+    int64_t p90;
+
+    /**
+     * \brief The 99th percentile.
+     */
+    int64_t p99;
+
+    /**
+     * \brief The 99.9th percentile.
+     */
+    int64_t p999;
+} DsVeosCoSim_LatencyStatistics;
+
 /**
  * \brief Represents the severity of a log message.
  */
@@ -347,6 +435,46 @@ typedef struct DsVeosCoSim_IoSignal {
     const char* name;
 } DsVeosCoSim_IoSignal;
 
+/**
+ * \brief Represents a value to be written to an IO signal.
+ */
+typedef struct DsVeosCoSim_IoSignalWriteValue {
+    /**
+     * \brief Id of the IO signal.
+     */
+    DsVeosCoSim_IoSignalId id;
+
+    /**
+     * \brief Length of the value to write.
+     */
+    uint32_t length;
+
+    /**
+     * \brief Value to write.
+     */
+    const void* value;
+} DsVeosCoSim_IoSignalWriteValue;
+
+/**
+ * \brief Represents a value to be read from an IO signal.
+ */
+typedef struct DsVeosCoSim_IoSignalReadValue {
+    /**
+     * \brief Id of the IO signal.
+     */
+    DsVeosCoSim_IoSignalId id;
+
+    /**
+     * \brief Read length.
+     */
+    uint32_t length;
+
+    /**
+     * \brief Buffer receiving the read value. It must be large enough for the maximum length of the IO signal.
+     */
+    void* value;
+} DsVeosCoSim_IoSignalReadValue;
+
 /**
  * \brief Represents a CAN controller.
  */
@@ -748,6 +876,22 @@ typedef struct DsVeosCoSim_LinMessage {
     const uint8_t* data;
 } DsVeosCoSim_LinMessage;
 
+/**
+ * \brief Represents an acceptance filter entry for CAN and LIN message IDs.
+ *        A message is accepted, if (id & mask) == (match & mask).
+ */
+typedef struct DsVeosCoSim_BusMessageIdFilter {
+    /**
+     * \brief The bits of the message ID, which are compared.
+     */
+    uint32_t mask;
+
+    /**
+     * \brief The expected values of the compared bits.
+     */
+    uint32_t match;
+} DsVeosCoSim_BusMessageIdFilter;
+
 /**
  * \brief Represents the log callback function pointer.
  * \param severity      The severity of the message.
@@ -1037,6 +1181,39 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignal(DsVeosCoSim_H
                                                                    uint32_t* length,
                                                                    void* value);
 
+/**
+ * \brief Reads the values of multiple incoming signals at once.
+ * \param handle                The handle.
+ * \param incomingSignalsCount  The count of incoming signals to read.
+ * \param incomingSignals       The incoming signals to read.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignals(DsVeosCoSim_Handle handle,
+                                                                    uint32_t incomingSignalsCount,
+                                                                    DsVeosCoSim_IoSignalReadValue* incomingSignals);
+
+/**
+ * \brief Resolves the incoming signal with the given id to a handle for DsVeosCoSim_ReadIncomingSignalFast.
+ * \param handle                The handle.
+ * \param incomingSignalId      The incoming signal id.
+ * \param incomingSignalHandle  The incoming signal handle.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_GetIncomingSignalHandle(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_IoSignalId incomingSignalId,
+    DsVeosCoSim_IoSignalHandle* incomingSignalHandle);
+
+/**
+ * \brief Reads a value from the incoming signal identified by the given signal handle without looking up its id.
+ * \param handle                The handle.
+ * \param incomingSignalHandle  The incoming signal handle.
+ * \param length                The read length.
+ * \param value                 The read value.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignalFast(DsVeosCoSim_Handle handle,
+                                                                       DsVeosCoSim_IoSignalHandle incomingSignalHandle,
+                                                                       uint32_t* length,
+                                                                       void* value);
+
 /**
  * \brief Gets all available outgoing signals.
  * \param handle                The handle.
@@ -1059,6 +1236,41 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignal(DsVeosCoSim_
                                                                     uint32_t length,
                                                                     const void* value);
 
+/**
+ * \brief Writes the given values to multiple outgoing signals at once.
+ * \param handle                The handle.
+ * \param outgoingSignalsCount  The count of outgoing signals to write.
+ * \param outgoingSignals       The outgoing signals to write.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignals(
+    DsVeosCoSim_Handle handle,
+    uint32_t outgoingSignalsCount,
+    const DsVeosCoSim_IoSignalWriteValue* outgoingSignals);
+
+/**
+ * \brief Resolves the outgoing signal with the given id to a handle for DsVeosCoSim_WriteOutgoingSignalFast.
+ * \param handle                The handle.
+ * \param outgoingSignalId      The outgoing signal id.
+ * \param outgoingSignalHandle  The outgoing signal handle.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_GetOutgoingSignalHandle(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_IoSignalId outgoingSignalId,
+    DsVeosCoSim_IoSignalHandle* outgoingSignalHandle);
+
+/**
+ * \brief Writes the given value to the outgoing signal identified by the given signal handle without looking up its
+ *        id.
+ * \param handle                The handle.
+ * \param outgoingSignalHandle  The outgoing signal handle.
+ * \param length                The length of the value to write.
+ * \param value                 The value to write.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignalFast(DsVeosCoSim_Handle handle,
+                                                                        DsVeosCoSim_IoSignalHandle outgoingSignalHandle,
+                                                                        uint32_t length,
+                                                                        const void* value);
+
 /**
  * \brief Gets all available CAN controllers.
  * \param handle                The handle.
@@ -1085,6 +1297,78 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessage(DsVeosCoSim_Ha
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitCanMessage(DsVeosCoSim_Handle handle,
                                                                    const DsVeosCoSim_CanMessage* message);
 
+/**
+ * \brief Receives up to maxCount CAN messages from the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param messages        The received CAN messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessages(DsVeosCoSim_Handle handle,
+                                                                   DsVeosCoSim_CanMessage* messages,
+                                                                   uint32_t maxCount,
+                                                                   uint32_t* receivedCount);
+
+/**
+ * \brief Receives a CAN message of the given controller from the dSPACE VEOS CoSim server identified by the given
+ *        handle. Messages of other controllers stay queued.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param message         The received CAN message.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessageFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_CanMessage* message);
+
+/**
+ * \brief Receives up to maxCount CAN messages of the given controller from the dSPACE VEOS CoSim server identified by
+ *        the given handle. Messages of other controllers stay queued.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param messages        The received CAN messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessagesFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_CanMessage* messages,
+    uint32_t maxCount,
+    uint32_t* receivedCount);
+
+/**
+ * \brief Transmits the given CAN messages in order to the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Full, if a message was dropped because its queue was full.
+ * \param handle              The handle.
+ * \param messages            The messages to transmit. May be null, if count is 0.
+ * \param count               The count of messages to transmit.
+ * \param transmittedCount    The count of transmitted messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitCanMessages(DsVeosCoSim_Handle handle,
+                                                                    const DsVeosCoSim_CanMessage* messages,
+                                                                    uint32_t count,
+                                                                    uint32_t* transmittedCount);
+
+/**
+ * \brief Sets the acceptance filter of the given CAN controller for the dSPACE VEOS CoSim server identified by the
+ *        given handle. Received messages of the controller, which match none of the filters, are dropped before they
+ *        are queued or passed to the callback. An empty filter list accepts all messages again.
+ *        The filter applies until the client disconnects.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param filters         The filters. May be null, if filtersCount is 0.
+ * \param filtersCount    The count of filters.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_SetCanAcceptanceFilter(DsVeosCoSim_Handle handle,
+                                                                       DsVeosCoSim_BusControllerId controllerId,
+                                                                       const DsVeosCoSim_BusMessageIdFilter* filters,
+                                                                       uint32_t filtersCount);
+
 /**
  * \brief Gets all available ethernet controllers.
  * \param handle                The handle.
@@ -1111,6 +1395,63 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessage(DsVeosCoSim_Ha
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitEthMessage(DsVeosCoSim_Handle handle,
                                                                    const DsVeosCoSim_EthMessage* message);
 
+/**
+ * \brief Receives up to maxCount ethernet messages from the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param messages        The received ethernet messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessages(DsVeosCoSim_Handle handle,
+                                                                   DsVeosCoSim_EthMessage* messages,
+                                                                   uint32_t maxCount,
+                                                                   uint32_t* receivedCount);
+
+/**
+ * \brief Receives an ethernet message of the given controller from the dSPACE VEOS CoSim server identified by the
+ *        given handle. Messages of other controllers stay queued.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param message         The received ethernet message.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessageFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_EthMessage* message);
+
+/**
+ * \brief Receives up to maxCount ethernet messages of the given controller from the dSPACE VEOS CoSim server
+ *        identified by the given handle. Messages of other controllers stay queued.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param messages        The received ethernet messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessagesFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_EthMessage* messages,
+    uint32_t maxCount,
+    uint32_t* receivedCount);
+
+/**
+ * \brief Transmits the given ethernet messages in order to the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Full, if a message was dropped because its queue was full.
+ * \param handle              The handle.
+ * \param messages            The messages to transmit. May be null, if count is 0.
+ * \param count               The count of messages to transmit.
+ * \param transmittedCount    The count of transmitted messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitEthMessages(DsVeosCoSim_Handle handle,
+                                                                    const DsVeosCoSim_EthMessage* messages,
+                                                                    uint32_t count,
+                                                                    uint32_t* transmittedCount);
+
 /**
  * \brief Gets all available LIN controllers.
  * \param handle                The handle.
@@ -1137,6 +1478,78 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessage(DsVeosCoSim_Ha
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitLinMessage(DsVeosCoSim_Handle handle,
                                                                    const DsVeosCoSim_LinMessage* message);
 
+/**
+ * \brief Receives up to maxCount LIN messages from the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param messages        The received LIN messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessages(DsVeosCoSim_Handle handle,
+                                                                   DsVeosCoSim_LinMessage* messages,
+                                                                   uint32_t maxCount,
+                                                                   uint32_t* receivedCount);
+
+/**
+ * \brief Receives a LIN message of the given controller from the dSPACE VEOS CoSim server identified by the given
+ *        handle. Messages of other controllers stay queued.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param message         The received LIN message.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessageFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_LinMessage* message);
+
+/**
+ * \brief Receives up to maxCount LIN messages of the given controller from the dSPACE VEOS CoSim server identified by
+ *        the given handle. Messages of other controllers stay queued.
+ *        Returns DsVeosCoSim_Result_Empty, if no message was received.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param messages        The received LIN messages. Must have room for maxCount messages. May be null, if
+ *                        maxCount is 0.
+ * \param maxCount        The maximum count of messages to receive.
+ * \param receivedCount   The count of received messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessagesFromController(
+    DsVeosCoSim_Handle handle,
+    DsVeosCoSim_BusControllerId controllerId,
+    DsVeosCoSim_LinMessage* messages,
+    uint32_t maxCount,
+    uint32_t* receivedCount);
+
+/**
+ * \brief Transmits the given LIN messages in order to the dSPACE VEOS CoSim server identified by the given handle.
+ *        Returns DsVeosCoSim_Result_Full, if a message was dropped because its queue was full.
+ * \param handle              The handle.
+ * \param messages            The messages to transmit. May be null, if count is 0.
+ * \param count               The count of messages to transmit.
+ * \param transmittedCount    The count of transmitted messages.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TransmitLinMessages(DsVeosCoSim_Handle handle,
+                                                                    const DsVeosCoSim_LinMessage* messages,
+                                                                    uint32_t count,
+                                                                    uint32_t* transmittedCount);
+
+/**
+ * \brief Sets the acceptance filter of the given LIN controller for the dSPACE VEOS CoSim server identified by the
+ *        given handle. Received messages of the controller, which match none of the filters, are dropped before they
+ *        are queued or passed to the callback. An empty filter list accepts all messages again.
+ *        The filter applies until the client disconnects.
+ * \param handle          The handle.
+ * \param controllerId    The id of the controller.
+ * \param filters         The filters. May be null, if filtersCount is 0.
+ * \param filtersCount    The count of filters.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_SetLinAcceptanceFilter(DsVeosCoSim_Handle handle,
+                                                                       DsVeosCoSim_BusControllerId controllerId,
+                                                                       const DsVeosCoSim_BusMessageIdFilter* filters,
+                                                                       uint32_t filtersCount);
+
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_StartSimulation(DsVeosCoSim_Handle handle);
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_StopSimulation(DsVeosCoSim_Handle handle);
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_PauseSimulation(DsVeosCoSim_Handle handle);
@@ -1147,10 +1560,29 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_TerminateSimulation(DsVeosCoSim_
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_GetCurrentSimulationTime(DsVeosCoSim_Handle handle,
                                                                          DsVeosCoSim_SimulationTime* simulationTime);
 
+/**
+ * \brief Gets the latency statistics of the protocol round trips. Can be called from any thread.
+ * \param handle        The handle.
+ * \param command       The command of the round trip.
+ * \param phase         The phase of the round trip.
+ * \param statistics    The latency statistics as an out value.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_GetLatencyStatistics(DsVeosCoSim_Handle handle,
+                                                                     DsVeosCoSim_Command command,
+                                                                     DsVeosCoSim_LatencyPhase phase,
+                                                                     DsVeosCoSim_LatencyStatistics* statistics);
+
+/**
+ * \brief Resets the latency statistics of the protocol round trips.
+ * \param handle    The handle.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ResetLatencyStatistics(DsVeosCoSim_Handle handle);
+
 #ifdef __cplusplus
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_SimulationTimeToString(DsVeosCoSim_SimulationTime simulationTime);
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_ResultToString(DsVeosCoSim_Result result);
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_CommandToString(DsVeosCoSim_Command command);
+extern DSVEOSCOSIM_API std::string DsVeosCoSim_LatencyPhaseToString(DsVeosCoSim_LatencyPhase latencyPhase);
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_SeverityToString(DsVeosCoSim_Severity severity);
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_TerminateReasonToString(DsVeosCoSim_TerminateReason terminateReason);
 extern DSVEOSCOSIM_API std::string DsVeosCoSim_ConnectionStateToString(DsVeosCoSim_ConnectionState connectionState);
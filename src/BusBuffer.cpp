@@ -2,49 +2,91 @@
 
 #include "BusBuffer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "Channel.h"
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "Environment.h"
+#include "Protocol.h"
 #include "RingBuffer.h"
-
-#ifdef _WIN32
-#include <atomic>
-
 #include "SharedMemory.h"
-#endif
 
 namespace DsVeosCoSim {
 
 namespace {
 
-[[nodiscard]] bool SerializeTo(const CanMessageContainer& message, ChannelWriter& writer) {
+// Timestamps are sent relative to the time of the step, zigzag encoded, so both signs stay small
+[[nodiscard]] uint64_t EncodeTimestamp(const SimulationTime timestamp, const SimulationTime referenceTime) {
+    const auto delta = static_cast<int64_t>(static_cast<uint64_t>(timestamp.count()) -
+                                            static_cast<uint64_t>(referenceTime.count()));
+    return (static_cast<uint64_t>(delta) << 1U) ^ static_cast<uint64_t>(delta >> 63U);
+}
+
+[[nodiscard]] SimulationTime DecodeTimestamp(const uint64_t value, const SimulationTime referenceTime) {
+    const uint64_t delta = (value >> 1U) ^ (~(value & 1U) + 1U);
+    return SimulationTime(static_cast<int64_t>(static_cast<uint64_t>(referenceTime.count()) + delta));
+}
+
+[[nodiscard]] bool SerializeTo(const CanMessage& message, ChannelWriter& writer) {
     CheckResultWithMessage(writer.Write(message.timestamp), "Could not write timestamp.");
     CheckResultWithMessage(writer.Write(message.controllerId), "Could not write controller id.");
     CheckResultWithMessage(writer.Write(message.id), "Could not write id.");
     CheckResultWithMessage(writer.Write(message.flags), "Could not write flags.");
     CheckResultWithMessage(writer.Write(message.length), "Could not write length.");
-    CheckResultWithMessage(writer.Write(message.data.data(), message.length), "Could not write data.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
     return true;
 }
 
-[[nodiscard]] bool DeserializeFrom(CanMessageContainer& message, ChannelReader& reader) {
+[[nodiscard]] bool DeserializeFrom(CanMessage& message, ChannelReader& reader) {
     CheckResultWithMessage(reader.Read(message.timestamp), "Could not read timestamp.");
     CheckResultWithMessage(reader.Read(message.controllerId), "Could not read controller id.");
     CheckResultWithMessage(reader.Read(message.id), "Could not read id.");
     CheckResultWithMessage(reader.Read(message.flags), "Could not read flags.");
     CheckResultWithMessage(reader.Read(message.length), "Could not read length");
     message.CheckMaxLength();
-    CheckResultWithMessage(reader.Read(message.data.data(), message.length), "Could not read data.");
+    message.CheckFlags();
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
+    return true;
+}
+
+[[nodiscard]] bool SerializeCompactTo(const CanMessage& message,
+                                      ChannelWriter& writer,
+                                      const SimulationTime referenceTime) {
+    CheckResultWithMessage(writer.WriteVarint(EncodeTimestamp(message.timestamp, referenceTime)),
+                           "Could not write timestamp.");
+    CheckResultWithMessage(writer.WriteVarint(message.id), "Could not write id.");
+    CheckResultWithMessage(writer.WriteVarint(message.flags), "Could not write flags.");
+    CheckResultWithMessage(writer.WriteVarint(message.length), "Could not write length.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
+    return true;
+}
+
+[[nodiscard]] bool DeserializeCompactFrom(CanMessage& message,
+                                          ChannelReader& reader,
+                                          const SimulationTime referenceTime) {
+    uint64_t timestamp{};
+    CheckResultWithMessage(reader.ReadVarint(timestamp), "Could not read timestamp.");
+    message.timestamp = DecodeTimestamp(timestamp, referenceTime);
+    CheckResultWithMessage(reader.ReadVarint(message.id), "Could not read id.");
+    CheckResultWithMessage(reader.ReadVarint(message.flags), "Could not read flags.");
+    CheckResultWithMessage(reader.ReadVarint(message.length), "Could not read length.");
+    message.CheckMaxLength();
+    message.CheckFlags();
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
     return true;
 }
 
@@ -57,22 +99,55 @@ void WriteTo(const CanMessageContainer& container, CanMessage& message) {
     message.data = container.data.data();
 }
 
-[[nodiscard]] bool SerializeTo(const EthMessageContainer& message, ChannelWriter& writer) {
+void WriteTo(const CanMessage& message, CanMessageContainer& container) {
+    container.timestamp = message.timestamp;
+    container.controllerId = message.controllerId;
+    container.id = message.id;
+    container.flags = message.flags;
+    container.length = message.length;
+    (void)memcpy(container.data.data(), message.data, message.length);
+}
+
+[[nodiscard]] bool SerializeTo(const EthMessage& message, ChannelWriter& writer) {
     CheckResultWithMessage(writer.Write(message.timestamp), "Could not write timestamp.");
     CheckResultWithMessage(writer.Write(message.controllerId), "Could not write controller id.");
     CheckResultWithMessage(writer.Write(message.flags), "Could not write flags.");
     CheckResultWithMessage(writer.Write(message.length), "Could not write length.");
-    CheckResultWithMessage(writer.Write(message.data.data(), message.length), "Could not write data.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
     return true;
 }
 
-[[nodiscard]] bool DeserializeFrom(EthMessageContainer& message, ChannelReader& reader) {
+[[nodiscard]] bool DeserializeFrom(EthMessage& message, ChannelReader& reader) {
     CheckResultWithMessage(reader.Read(message.timestamp), "Could not read timestamp.");
     CheckResultWithMessage(reader.Read(message.controllerId), "Could not read controller id.");
     CheckResultWithMessage(reader.Read(message.flags), "Could not read flags.");
     CheckResultWithMessage(reader.Read(message.length), "Could not read length.");
     message.CheckMaxLength();
-    CheckResultWithMessage(reader.Read(message.data.data(), message.length), "Could not read data.");
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
+    return true;
+}
+
+[[nodiscard]] bool SerializeCompactTo(const EthMessage& message,
+                                      ChannelWriter& writer,
+                                      const SimulationTime referenceTime) {
+    CheckResultWithMessage(writer.WriteVarint(EncodeTimestamp(message.timestamp, referenceTime)),
+                           "Could not write timestamp.");
+    CheckResultWithMessage(writer.WriteVarint(message.flags), "Could not write flags.");
+    CheckResultWithMessage(writer.WriteVarint(message.length), "Could not write length.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
+    return true;
+}
+
+[[nodiscard]] bool DeserializeCompactFrom(EthMessage& message,
+                                          ChannelReader& reader,
+                                          const SimulationTime referenceTime) {
+    uint64_t timestamp{};
+    CheckResultWithMessage(reader.ReadVarint(timestamp), "Could not read timestamp.");
+    message.timestamp = DecodeTimestamp(timestamp, referenceTime);
+    CheckResultWithMessage(reader.ReadVarint(message.flags), "Could not read flags.");
+    CheckResultWithMessage(reader.ReadVarint(message.length), "Could not read length.");
+    message.CheckMaxLength();
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
     return true;
 }
 
@@ -84,24 +159,58 @@ void WriteTo(const EthMessageContainer& container, EthMessage& message) {
     message.data = container.data.data();
 }
 
-[[nodiscard]] bool SerializeTo(const LinMessageContainer& message, ChannelWriter& writer) {
+void WriteTo(const EthMessage& message, EthMessageContainer& container) {
+    container.timestamp = message.timestamp;
+    container.controllerId = message.controllerId;
+    container.flags = message.flags;
+    container.length = message.length;
+    (void)memcpy(container.data.data(), message.data, message.length);
+}
+
+[[nodiscard]] bool SerializeTo(const LinMessage& message, ChannelWriter& writer) {
     CheckResultWithMessage(writer.Write(message.timestamp), "Could not write timestamp.");
     CheckResultWithMessage(writer.Write(message.controllerId), "Could not write controller id.");
     CheckResultWithMessage(writer.Write(message.id), "Could not write id.");
     CheckResultWithMessage(writer.Write(message.flags), "Could not write flags.");
     CheckResultWithMessage(writer.Write(message.length), "Could not write length.");
-    CheckResultWithMessage(writer.Write(message.data.data(), message.length), "Could not write data.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
     return true;
 }
 
-[[nodiscard]] bool DeserializeFrom(LinMessageContainer& message, ChannelReader& reader) {
+[[nodiscard]] bool DeserializeFrom(LinMessage& message, ChannelReader& reader) {
     CheckResultWithMessage(reader.Read(message.timestamp), "Could not read timestamp.");
     CheckResultWithMessage(reader.Read(message.controllerId), "Could not read controller id.");
     CheckResultWithMessage(reader.Read(message.id), "Could not read id.");
     CheckResultWithMessage(reader.Read(message.flags), "Could not read flags.");
     CheckResultWithMessage(reader.Read(message.length), "Could not read length.");
     message.CheckMaxLength();
-    CheckResultWithMessage(reader.Read(message.data.data(), message.length), "Could not read data.");
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
+    return true;
+}
+
+[[nodiscard]] bool SerializeCompactTo(const LinMessage& message,
+                                      ChannelWriter& writer,
+                                      const SimulationTime referenceTime) {
+    CheckResultWithMessage(writer.WriteVarint(EncodeTimestamp(message.timestamp, referenceTime)),
+                           "Could not write timestamp.");
+    CheckResultWithMessage(writer.WriteVarint(message.id), "Could not write id.");
+    CheckResultWithMessage(writer.WriteVarint(message.flags), "Could not write flags.");
+    CheckResultWithMessage(writer.WriteVarint(message.length), "Could not write length.");
+    CheckResultWithMessage(writer.Write(message.data, message.length), "Could not write data.");
+    return true;
+}
+
+[[nodiscard]] bool DeserializeCompactFrom(LinMessage& message,
+                                          ChannelReader& reader,
+                                          const SimulationTime referenceTime) {
+    uint64_t timestamp{};
+    CheckResultWithMessage(reader.ReadVarint(timestamp), "Could not read timestamp.");
+    message.timestamp = DecodeTimestamp(timestamp, referenceTime);
+    CheckResultWithMessage(reader.ReadVarint(message.id), "Could not read id.");
+    CheckResultWithMessage(reader.ReadVarint(message.flags), "Could not read flags.");
+    CheckResultWithMessage(reader.ReadVarint(message.length), "Could not read length.");
+    message.CheckMaxLength();
+    CheckResultWithMessage(reader.ReadView(message.length, message.data), "Could not read data.");
     return true;
 }
 
@@ -114,6 +223,222 @@ void WriteTo(const LinMessageContainer& container, LinMessage& message) {
     message.data = container.data.data();
 }
 
+void WriteTo(const LinMessage& message, LinMessageContainer& container) {
+    container.timestamp = message.timestamp;
+    container.controllerId = message.controllerId;
+    container.id = message.id;
+    container.flags = message.flags;
+    container.length = message.length;
+    (void)memcpy(container.data.data(), message.data, message.length);
+}
+
+// Stores every message in a container of the maximum message length
+template <typename TMessage, typename TMessageExtern>
+class ContainerMessageQueue final {
+public:
+    void Initialize(const size_t capacity) {
+        _messages = RingBuffer<TMessage>(capacity);
+    }
+
+    void Clear() {
+        _messages.Clear();
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return _messages.Size();
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return _messages.IsEmpty();
+    }
+
+    void PushBack(const TMessageExtern& messageExtern) {
+        messageExtern.CheckMaxLength();
+        WriteTo(messageExtern, _messages.PushBackSlot());
+    }
+
+    void PopFront(TMessageExtern& messageExtern) {
+        WriteTo(_messages.PopFront(), messageExtern);
+    }
+
+private:
+    RingBuffer<TMessage> _messages;
+};
+
+// Most ethernet frames are much smaller than the maximum length, so only the actual bytes are stored
+class EthMessageQueue final {
+    struct Header {
+        SimulationTime timestamp;
+        BusControllerId controllerId;
+        EthMessageFlags flags;
+    };
+
+public:
+    void Initialize(const size_t capacity) {
+        // The arena only grows up to the size of full queues, when the controllers actually send that much data
+        _messages =
+            ArenaRingBuffer<Header>(ArenaRingBuffer<Header>::GetRequiredCapacity(capacity, EthMessageMaxLength));
+    }
+
+    void Clear() {
+        _messages.Clear();
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return _messages.Size();
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return _messages.IsEmpty();
+    }
+
+    void PushBack(const EthMessage& messageExtern) {
+        messageExtern.CheckMaxLength();
+        const Header header{messageExtern.timestamp, messageExtern.controllerId, messageExtern.flags};
+        _messages.PushBack(header, messageExtern.data, messageExtern.length);
+    }
+
+    void PopFront(EthMessage& messageExtern) {
+        Header header{};
+        messageExtern.data = _messages.PopFront(header, messageExtern.length);
+        messageExtern.timestamp = header.timestamp;
+        messageExtern.controllerId = header.controllerId;
+        messageExtern.flags = header.flags;
+    }
+
+private:
+    ArenaRingBuffer<Header> _messages;
+};
+
+// Keeps one queue per controller, so a single controller can be drained without touching the others. The order of all
+// messages is kept as a ring of controller indices. Entries of messages, which were already received per controller,
+// are skipped lazily
+template <typename TMessageQueue, typename TMessageExtern>
+class ControllerMessageQueues final {
+public:
+    void Initialize(const std::vector<uint32_t>& queueSizes) {
+        _queues = std::vector<TMessageQueue>(queueSizes.size());
+        _skippedCounts.assign(queueSizes.size(), 0);
+
+        size_t totalQueueSize = 0;
+        for (size_t i = 0; i < queueSizes.size(); i++) {
+            _queues[i].Initialize(queueSizes[i]);
+            totalQueueSize += queueSizes[i];
+        }
+
+        _order = RingBuffer<uint32_t>(totalQueueSize);
+    }
+
+    void Clear() {
+        for (TMessageQueue& queue : _queues) {
+            queue.Clear();
+        }
+
+        for (uint32_t& skippedCount : _skippedCounts) {
+            skippedCount = 0;
+        }
+
+        _order.Clear();
+        _size = 0;
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return _size;
+    }
+
+    [[nodiscard]] size_t Size(const size_t controllerIndex) const {
+        return _queues[controllerIndex].Size();
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return _size == 0;
+    }
+
+    void PushBack(const size_t controllerIndex, const TMessageExtern& messageExtern) {
+        _queues[controllerIndex].PushBack(messageExtern);
+
+        if (_order.IsFull()) {
+            RemoveSkippedEntries();
+        }
+
+        _order.PushBack(static_cast<uint32_t>(controllerIndex));
+        ++_size;
+    }
+
+    // Pops the oldest message of all controllers and returns the index of its controller
+    [[nodiscard]] size_t PopFront(TMessageExtern& messageExtern) {
+        uint32_t controllerIndex = _order.PopFront();
+        while (_skippedCounts[controllerIndex] > 0) {
+            --_skippedCounts[controllerIndex];
+            controllerIndex = _order.PopFront();
+        }
+
+        _queues[controllerIndex].PopFront(messageExtern);
+        --_size;
+        return controllerIndex;
+    }
+
+    void PopFront(const size_t controllerIndex, TMessageExtern& messageExtern) {
+        _queues[controllerIndex].PopFront(messageExtern);
+        ++_skippedCounts[controllerIndex];
+        --_size;
+    }
+
+private:
+    // Only needed, if messages are only received per controller, since the ring is never drained then
+    void RemoveSkippedEntries() {
+        const size_t count = _order.Size();
+        for (size_t i = 0; i < count; i++) {
+            uint32_t controllerIndex = _order.PopFront();
+            if (_skippedCounts[controllerIndex] > 0) {
+                --_skippedCounts[controllerIndex];
+                continue;
+            }
+
+            _order.PushBack(std::move(controllerIndex));
+        }
+    }
+
+    std::vector<TMessageQueue> _queues;
+    std::vector<uint32_t> _skippedCounts;
+    RingBuffer<uint32_t> _order;
+    size_t _size{};
+};
+
+using CanMessageQueue = ContainerMessageQueue<CanMessageContainer, CanMessage>;
+using LinMessageQueue = ContainerMessageQueue<LinMessageContainer, LinMessage>;
+
+// The results for the 11 bit id range are precomputed, so standard CAN ids are checked with a single lookup
+class AcceptanceFilter final {
+public:
+    explicit AcceptanceFilter(std::vector<BusMessageIdFilter> filters) : _filters(std::move(filters)) {
+        for (uint32_t id = 0; id < StandardIdCount; id++) {
+            _acceptedStandardIds[id] = Matches(id);
+        }
+    }
+
+    [[nodiscard]] bool Accepts(const BusMessageId busMessageId) const {
+        const auto id = static_cast<uint32_t>(busMessageId);
+        if (id < StandardIdCount) {
+            return _acceptedStandardIds[id];
+        }
+
+        return Matches(id);
+    }
+
+private:
+    static constexpr uint32_t StandardIdCount = 2048;
+
+    [[nodiscard]] bool Matches(const uint32_t id) const {
+        return std::any_of(_filters.begin(), _filters.end(), [id](const BusMessageIdFilter& filter) {
+            return (id & filter.mask) == (filter.match & filter.mask);
+        });
+    }
+
+    std::vector<BusMessageIdFilter> _filters;
+    std::bitset<StandardIdCount> _acceptedStandardIds;
+};
+
 template <typename TMessageExtern, typename TControllerExtern>
 class BusProtocolBufferBase {
 protected:
@@ -123,6 +448,7 @@ protected:
         TControllerExtern info{};
         bool warningSent{};
         size_t controllerIndex{};
+        std::optional<AcceptanceFilter> acceptanceFilter;
 
         void ClearData() {
             warningSent = false;
@@ -142,7 +468,8 @@ public:
     void Initialize(const CoSimType coSimType,
                     const std::string& name,
                     const std::vector<TControllerExtern>& controllers) {
-        _coSimType = coSimType;
+        // Only the client is accessed by the model thread and the protocol thread at the same time
+        _useMutex = (coSimType == CoSimType::Client) && !IsLockFree();
 
         size_t totalQueueItemsCountPerBuffer = 0;
         size_t nextControllerIndex = 0;
@@ -159,11 +486,16 @@ public:
             totalQueueItemsCountPerBuffer += controller.queueSize;
         }
 
+        // References into the map stay valid, since no controller is added afterward
+        for (const auto& controller : controllers) {
+            _controllersByIndex.push_back(&_controllers[controller.id]);
+        }
+
         InitializeInternal(name, totalQueueItemsCountPerBuffer);
     }
 
     void ClearData() {
-        if (_coSimType == CoSimType::Client) {
+        if (_useMutex) {
             std::lock_guard lock(_mutex);
             ClearDataInternal();
             return;
@@ -172,8 +504,19 @@ public:
         ClearDataInternal();
     }
 
+    // An empty list of filters accepts all messages again
+    void SetAcceptanceFilter(const BusControllerId controllerId, const std::vector<BusMessageIdFilter>& filters) {
+        if (_useMutex) {
+            std::lock_guard lock(_mutex);
+            SetAcceptanceFilterInternal(controllerId, filters);
+            return;
+        }
+
+        SetAcceptanceFilterInternal(controllerId, filters);
+    }
+
     [[nodiscard]] bool Transmit(const TMessageExtern& messageExtern) {
-        if (_coSimType == CoSimType::Client) {
+        if (_useMutex) {
             std::lock_guard lock(_mutex);
             return TransmitInternal(messageExtern);
         }
@@ -182,7 +525,7 @@ public:
     }
 
     [[nodiscard]] bool Receive(TMessageExtern& messageExtern) {
-        if (_coSimType == CoSimType::Client) {
+        if (_useMutex) {
             std::lock_guard lock(_mutex);
             return ReceiveInternal(messageExtern);
         }
@@ -190,62 +533,178 @@ public:
         return ReceiveInternal(messageExtern);
     }
 
-    [[nodiscard]] bool Serialize(ChannelWriter& writer) {
-        if (_coSimType == CoSimType::Client) {
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, TMessageExtern& messageExtern) {
+        if (_useMutex) {
+            std::lock_guard lock(_mutex);
+            return ReceiveInternal(FindController(controllerId), messageExtern);
+        }
+
+        return ReceiveInternal(FindController(controllerId), messageExtern);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const TMessageExtern* messagesExtern, const uint32_t count) {
+        if (_useMutex) {
+            std::lock_guard lock(_mutex);
+            return TransmitManyInternal(messagesExtern, count);
+        }
+
+        return TransmitManyInternal(messagesExtern, count);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(TMessageExtern* messagesExtern, const uint32_t maxCount) {
+        if (_useMutex) {
+            std::lock_guard lock(_mutex);
+            return ReceiveManyInternal(messagesExtern, maxCount);
+        }
+
+        return ReceiveManyInternal(messagesExtern, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       TMessageExtern* messagesExtern,
+                                       const uint32_t maxCount) {
+        if (_useMutex) {
+            std::lock_guard lock(_mutex);
+            return ReceiveManyInternal(FindController(controllerId), messagesExtern, maxCount);
+        }
+
+        return ReceiveManyInternal(FindController(controllerId), messagesExtern, maxCount);
+    }
+
+    [[nodiscard]] bool Serialize(ChannelWriter& writer, const SimulationTime referenceTime) {
+        if (_useMutex) {
             std::lock_guard lock(_mutex);
-            return SerializeInternal(writer);
+            return SerializeInternal(writer, referenceTime);
         }
 
-        return SerializeInternal(writer);
+        return SerializeInternal(writer, referenceTime);
     }
 
     [[nodiscard]] bool Deserialize(ChannelReader& reader,
                                    const SimulationTime simulationTime,
+                                   const SimulationTime referenceTime,
                                    const Callback& callback) {
-        if (_coSimType == CoSimType::Client) {
+        if (_useMutex) {
             std::lock_guard lock(_mutex);
-            return DeserializeInternal(reader, simulationTime, callback);
+            return DeserializeInternal(reader, simulationTime, referenceTime, callback);
         }
 
-        return DeserializeInternal(reader, simulationTime, callback);
+        return DeserializeInternal(reader, simulationTime, referenceTime, callback);
     }
 
 protected:
+    // Buffers, which synchronize their producer and consumer themselves, are used without the mutex
+    [[nodiscard]] virtual bool IsLockFree() const {
+        return false;
+    }
+
     virtual void InitializeInternal(const std::string& name, size_t totalQueueItemsCountPerBuffer) = 0;
 
     virtual void ClearDataInternal() = 0;
 
     [[nodiscard]] virtual bool TransmitInternal(const TMessageExtern& messageExtern) = 0;
     [[nodiscard]] virtual bool ReceiveInternal(TMessageExtern& messageExtern) = 0;
+    [[nodiscard]] virtual bool ReceiveInternal(const ControllerExtension& extension, TMessageExtern& messageExtern) = 0;
 
-    [[nodiscard]] virtual bool SerializeInternal(ChannelWriter& writer) = 0;
+    [[nodiscard]] virtual bool SerializeInternal(ChannelWriter& writer, SimulationTime referenceTime) = 0;
     [[nodiscard]] virtual bool DeserializeInternal(ChannelReader& reader,
                                                    SimulationTime simulationTime,
+                                                   SimulationTime referenceTime,
                                                    const Callback& callback) = 0;
 
     [[nodiscard]] ControllerExtension& FindController(BusControllerId controllerId) {
+        // Messages mostly come in runs of the same controller, so the map is only searched when the controller changes
+        if ((_lastController != nullptr) && (_lastController->info.id == controllerId)) {
+            return *_lastController;
+        }
+
         const auto search = _controllers.find(controllerId);
         if (search != _controllers.end()) {
+            _lastController = &search->second;
             return search->second;
         }
 
         throw CoSimException("Controller id " + ToString(controllerId) + " is unknown.");
     }
 
+    // ETH messages have no id, so they are always accepted
+    template <typename TMessage>
+    [[nodiscard]] static bool IsAccepted(const ControllerExtension& extension, const TMessage& message) {
+        if constexpr (std::is_same_v<TControllerExtern, EthController>) {
+            return true;
+        } else {
+            return !extension.acceptanceFilter || extension.acceptanceFilter->Accepts(message.id);
+        }
+    }
+
+    [[nodiscard]] ControllerExtension& FindControllerByIndex(const size_t controllerIndex) {
+        if (controllerIndex < _controllersByIndex.size()) {
+            return *_controllersByIndex[controllerIndex];
+        }
+
+        throw CoSimException("Controller index " + std::to_string(controllerIndex) + " is unknown.");
+    }
+
     std::unordered_map<BusControllerId, ControllerExtension> _controllers;
+    std::vector<ControllerExtension*> _controllersByIndex;
 
 private:
-    CoSimType _coSimType{};
+    void SetAcceptanceFilterInternal(const BusControllerId controllerId,
+                                     const std::vector<BusMessageIdFilter>& filters) {
+        ControllerExtension& extension = FindController(controllerId);
+        if (filters.empty()) {
+            extension.acceptanceFilter.reset();
+            return;
+        }
+
+        extension.acceptanceFilter.emplace(filters);
+    }
+
+    [[nodiscard]] uint32_t TransmitManyInternal(const TMessageExtern* messagesExtern, const uint32_t count) {
+        uint32_t transmittedCount = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            if (TransmitInternal(messagesExtern[i])) {
+                ++transmittedCount;
+            }
+        }
+
+        return transmittedCount;
+    }
+
+    [[nodiscard]] uint32_t ReceiveManyInternal(TMessageExtern* messagesExtern, const uint32_t maxCount) {
+        uint32_t receivedCount = 0;
+        while ((receivedCount < maxCount) && ReceiveInternal(messagesExtern[receivedCount])) {
+            ++receivedCount;
+        }
+
+        return receivedCount;
+    }
+
+    [[nodiscard]] uint32_t ReceiveManyInternal(const ControllerExtension& extension,
+                                               TMessageExtern* messagesExtern,
+                                               const uint32_t maxCount) {
+        uint32_t receivedCount = 0;
+        while ((receivedCount < maxCount) && ReceiveInternal(extension, messagesExtern[receivedCount])) {
+            ++receivedCount;
+        }
+
+        return receivedCount;
+    }
+
+    ControllerExtension* _lastController{};
+    bool _useMutex{};
     std::mutex _mutex;
 };
 
-template <typename TMessage, typename TMessageExtern, typename TControllerExtern>
+template <typename TMessageQueue, typename TMessageExtern, typename TControllerExtern>
 class RemoteBusProtocolBuffer final : public BusProtocolBufferBase<TMessageExtern, TControllerExtern> {
     using Base = BusProtocolBufferBase<TMessageExtern, TControllerExtern>;
     using Extension = typename Base::ControllerExtension;
 
 public:
-    RemoteBusProtocolBuffer() = default;
+    explicit RemoteBusProtocolBuffer(const bool useCompactEncoding) : _useCompactEncoding(useCompactEncoding) {
+    }
+
     ~RemoteBusProtocolBuffer() noexcept override = default;
 
     RemoteBusProtocolBuffer(const RemoteBusProtocolBuffer&) = delete;
@@ -255,9 +714,14 @@ public:
     RemoteBusProtocolBuffer& operator=(RemoteBusProtocolBuffer&&) = delete;
 
 protected:
-    void InitializeInternal([[maybe_unused]] const std::string& name, size_t totalQueueItemsCountPerBuffer) override {
-        _messageCountPerController.resize(this->_controllers.size());
-        _messageBuffer = RingBuffer<TMessage>(totalQueueItemsCountPerBuffer);
+    void InitializeInternal([[maybe_unused]] const std::string& name,
+                            [[maybe_unused]] size_t totalQueueItemsCountPerBuffer) override {
+        std::vector<uint32_t> queueSizes;
+        for (const Extension* extension : Base::_controllersByIndex) {
+            queueSizes.push_back(extension->info.queueSize);
+        }
+
+        _messageQueues.Initialize(queueSizes);
     }
 
     void ClearDataInternal() override {
@@ -265,17 +729,13 @@ protected:
             dataPerController.ClearData();
         }
 
-        for (auto& messageCount : _messageCountPerController) {
-            messageCount = 0;
-        }
-
-        _messageBuffer.Clear();
+        _messageQueues.Clear();
     }
 
     [[nodiscard]] bool TransmitInternal(const TMessageExtern& messageExtern) override {
         Extension& extension = Base::FindController(messageExtern.controllerId);
 
-        if (_messageCountPerController[extension.controllerIndex] == extension.info.queueSize) {
+        if (_messageQueues.Size(extension.controllerIndex) == extension.info.queueSize) {
             if (!extension.warningSent) {
                 LogWarning("Queue for controller '" + std::string(extension.info.name) +
                            "' is full. Messages are dropped.");
@@ -285,42 +745,45 @@ protected:
             return false;
         }
 
-        auto message = static_cast<TMessage>(messageExtern);
-
-        _messageBuffer.PushBack(std::move(message));
-        ++_messageCountPerController[extension.controllerIndex];
+        _messageQueues.PushBack(extension.controllerIndex, messageExtern);
         return true;
     }
 
     [[nodiscard]] bool ReceiveInternal(TMessageExtern& messageExtern) override {
-        if (_messageBuffer.IsEmpty()) {
+        if (_messageQueues.IsEmpty()) {
             return false;
         }
 
-        TMessage& message = _messageBuffer.PopFront();
-        WriteTo(message, messageExtern);
+        (void)_messageQueues.PopFront(messageExtern);
+        return true;
+    }
+
+    [[nodiscard]] bool ReceiveInternal(const Extension& extension, TMessageExtern& messageExtern) override {
+        if (_messageQueues.Size(extension.controllerIndex) == 0) {
+            return false;
+        }
 
-        Extension& extension = Base::FindController(message.controllerId);
-        --_messageCountPerController[extension.controllerIndex];
+        _messageQueues.PopFront(extension.controllerIndex, messageExtern);
         return true;
     }
 
-    [[nodiscard]] bool SerializeInternal(ChannelWriter& writer) override {
-        const auto count = static_cast<uint32_t>(_messageBuffer.Size());
-        CheckResultWithMessage(writer.Write(count), "Could not write count of messages.");
+    [[nodiscard]] bool SerializeInternal(ChannelWriter& writer, const SimulationTime referenceTime) override {
+        const auto count = static_cast<uint32_t>(_messageQueues.Size());
+        if (_useCompactEncoding) {
+            CheckResultWithMessage(writer.WriteVarint(count), "Could not write count of messages.");
+        } else {
+            CheckResultWithMessage(writer.Write(count), "Could not write count of messages.");
+        }
 
         for (uint32_t i = 0; i < count; i++) {
-            TMessage& message = _messageBuffer.PopFront();
+            TMessageExtern message{};
+            (void)_messageQueues.PopFront(message);
 
             if (IsProtocolTracingEnabled()) {
                 LogProtocolDataTrace(ToString(message));
             }
 
-            CheckResultWithMessage(SerializeTo(message, writer), "Could not serialize message.");
-        }
-
-        for (auto& [id, extension] : Base::_controllers) {
-            _messageCountPerController[extension.controllerIndex] = 0;
+            CheckResultWithMessage(SerializeMessage(message, writer, referenceTime), "Could not serialize message.");
         }
 
         return true;
@@ -328,26 +791,36 @@ protected:
 
     [[nodiscard]] bool DeserializeInternal(ChannelReader& reader,
                                            SimulationTime simulationTime,
+                                           SimulationTime referenceTime,
                                            const typename Base::Callback& callback) override {
         uint32_t totalCount{};
-        CheckResultWithMessage(reader.Read(totalCount), "Could not read count of messages.");
+        if (_useCompactEncoding) {
+            CheckResultWithMessage(reader.ReadVarint(totalCount), "Could not read count of messages.");
+        } else {
+            CheckResultWithMessage(reader.Read(totalCount), "Could not read count of messages.");
+        }
 
         for (uint32_t i = 0; i < totalCount; i++) {
-            TMessage message{};
-            CheckResultWithMessage(DeserializeFrom(message, reader), "Could not deserialize message.");
+            // The message is a view into the receive buffer, so the data is only copied when it is queued
+            TMessageExtern message{};
+            CheckResultWithMessage(DeserializeMessage(message, reader, referenceTime),
+                                   "Could not deserialize message.");
 
             if (IsProtocolTracingEnabled()) {
                 LogProtocolDataTrace(ToString(message));
             }
 
             Extension& extension = Base::FindController(message.controllerId);
+            if (!Base::IsAccepted(extension, message)) {
+                continue;
+            }
 
             if (callback) {
-                callback(simulationTime, extension.info, static_cast<TMessageExtern>(message));
+                callback(simulationTime, extension.info, message);
                 continue;
             }
 
-            if (_messageCountPerController[extension.controllerIndex] == extension.info.queueSize) {
+            if (_messageQueues.Size(extension.controllerIndex) == extension.info.queueSize) {
                 if (!extension.warningSent) {
                     LogWarning("Receive buffer for controller '" + std::string(extension.info.name) + "' is full.");
                     extension.warningSent = true;
@@ -356,20 +829,178 @@ protected:
                 continue;
             }
 
-            ++_messageCountPerController[extension.controllerIndex];
-            _messageBuffer.PushBack(std::move(message));
+            _messageQueues.PushBack(extension.controllerIndex, message);
         }
 
         return true;
     }
 
 private:
-    std::vector<uint32_t> _messageCountPerController;
+    // The compact encoding identifies the controller by its index instead of its id
+    [[nodiscard]] bool SerializeMessage(const TMessageExtern& message,
+                                        ChannelWriter& writer,
+                                        const SimulationTime referenceTime) {
+        if (!_useCompactEncoding) {
+            return SerializeTo(message, writer);
+        }
+
+        const size_t controllerIndex = Base::FindController(message.controllerId).controllerIndex;
+        CheckResultWithMessage(writer.WriteVarint(controllerIndex), "Could not write controller index.");
+        return SerializeCompactTo(message, writer, referenceTime);
+    }
+
+    [[nodiscard]] bool DeserializeMessage(TMessageExtern& message,
+                                          ChannelReader& reader,
+                                          const SimulationTime referenceTime) {
+        if (!_useCompactEncoding) {
+            return DeserializeFrom(message, reader);
+        }
+
+        size_t controllerIndex{};
+        CheckResultWithMessage(reader.ReadVarint(controllerIndex), "Could not read controller index.");
+        message.controllerId = Base::FindControllerByIndex(controllerIndex).info.id;
+        return DeserializeCompactFrom(message, reader, referenceTime);
+    }
 
-    RingBuffer<TMessage> _messageBuffer;
+    ControllerMessageQueues<TMessageQueue, TMessageExtern> _messageQueues;
+    bool _useCompactEncoding{};
 };
 
-#ifdef _WIN32
+// Transmit buffer of a remote client. The model thread transmits and the protocol thread serializes without sharing the
+// mutex, so the messages are passed through a lock-free ring and the per-controller counts are atomics
+template <typename TMessage, typename TMessageExtern, typename TControllerExtern>
+class RemoteTransmitBusProtocolBuffer final : public BusProtocolBufferBase<TMessageExtern, TControllerExtern> {
+    using Base = BusProtocolBufferBase<TMessageExtern, TControllerExtern>;
+    using Extension = typename Base::ControllerExtension;
+
+    struct Item {
+        size_t controllerIndex{};
+        TMessage message{};
+    };
+
+public:
+    explicit RemoteTransmitBusProtocolBuffer(const bool useCompactEncoding) : _useCompactEncoding(useCompactEncoding) {
+    }
+
+    ~RemoteTransmitBusProtocolBuffer() noexcept override = default;
+
+    RemoteTransmitBusProtocolBuffer(const RemoteTransmitBusProtocolBuffer&) = delete;
+    RemoteTransmitBusProtocolBuffer& operator=(const RemoteTransmitBusProtocolBuffer&) = delete;
+
+    RemoteTransmitBusProtocolBuffer(RemoteTransmitBusProtocolBuffer&&) = delete;
+    RemoteTransmitBusProtocolBuffer& operator=(RemoteTransmitBusProtocolBuffer&&) = delete;
+
+protected:
+    [[nodiscard]] bool IsLockFree() const override {
+        return true;
+    }
+
+    void InitializeInternal([[maybe_unused]] const std::string& name,
+                            const size_t totalQueueItemsCountPerBuffer) override {
+        const size_t controllerCount = Base::_controllersByIndex.size();
+        _messageCountPerController = std::make_unique<std::atomic<uint32_t>[]>(controllerCount);
+        _warningSentPerController = std::make_unique<std::atomic<bool>[]>(controllerCount);
+        _items = std::make_unique<SpscRingBuffer<Item>>(totalQueueItemsCountPerBuffer);
+    }
+
+    // Runs on the protocol thread, so the ring is drained as its consumer
+    void ClearDataInternal() override {
+        Item item{};
+        while (_items->TryPopFront(item)) {
+            _messageCountPerController[item.controllerIndex].fetch_sub(1);
+        }
+
+        for (size_t i = 0; i < Base::_controllersByIndex.size(); i++) {
+            _warningSentPerController[i] = false;
+        }
+    }
+
+    [[nodiscard]] bool TransmitInternal(const TMessageExtern& messageExtern) override {
+        // Only transmitting threads exclude each other, so the protocol thread never waits for them
+        std::lock_guard lock(_transmitMutex);
+
+        const Extension& extension = Base::FindController(messageExtern.controllerId);
+        const size_t controllerIndex = extension.controllerIndex;
+
+        if (_messageCountPerController[controllerIndex] >= extension.info.queueSize) {
+            if (!_warningSentPerController[controllerIndex].exchange(true)) {
+                LogWarning("Queue for controller '" + std::string(extension.info.name) +
+                           "' is full. Messages are dropped.");
+            }
+
+            return false;
+        }
+
+        messageExtern.CheckMaxLength();
+        Item item{};
+        item.controllerIndex = controllerIndex;
+        WriteTo(messageExtern, item.message);
+
+        // The message is counted before the consumer can see it, so the count never drops below zero. The ring holds
+        // the sum of all queue sizes, so it is never full while a controller has space left
+        _messageCountPerController[controllerIndex].fetch_add(1);
+        (void)_items->TryPushBack(std::move(item));
+        return true;
+    }
+
+    // Messages are only transmitted through this buffer
+    [[nodiscard]] bool ReceiveInternal([[maybe_unused]] TMessageExtern& messageExtern) override {
+        return false;
+    }
+
+    [[nodiscard]] bool ReceiveInternal([[maybe_unused]] const Extension& extension,
+                                       [[maybe_unused]] TMessageExtern& messageExtern) override {
+        return false;
+    }
+
+    [[nodiscard]] bool SerializeInternal(ChannelWriter& writer, const SimulationTime referenceTime) override {
+        // Messages transmitted while serializing are sent with the next frame
+        const auto count = static_cast<uint32_t>(_items->Size());
+        if (_useCompactEncoding) {
+            CheckResultWithMessage(writer.WriteVarint(count), "Could not write count of messages.");
+        } else {
+            CheckResultWithMessage(writer.Write(count), "Could not write count of messages.");
+        }
+
+        Item item{};
+        for (uint32_t i = 0; i < count; i++) {
+            (void)_items->TryPopFront(item);
+
+            TMessageExtern message{};
+            WriteTo(item.message, message);
+
+            if (IsProtocolTracingEnabled()) {
+                LogProtocolDataTrace(ToString(message));
+            }
+
+            if (_useCompactEncoding) {
+                CheckResultWithMessage(writer.WriteVarint(item.controllerIndex), "Could not write controller index.");
+                CheckResultWithMessage(SerializeCompactTo(message, writer, referenceTime),
+                                       "Could not serialize message.");
+            } else {
+                CheckResultWithMessage(SerializeTo(message, writer), "Could not serialize message.");
+            }
+
+            _messageCountPerController[item.controllerIndex].fetch_sub(1);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool DeserializeInternal([[maybe_unused]] ChannelReader& reader,
+                                           [[maybe_unused]] SimulationTime simulationTime,
+                                           [[maybe_unused]] SimulationTime referenceTime,
+                                           [[maybe_unused]] const typename Base::Callback& callback) override {
+        return false;
+    }
+
+private:
+    std::unique_ptr<SpscRingBuffer<Item>> _items;
+    std::unique_ptr<std::atomic<uint32_t>[]> _messageCountPerController;
+    std::unique_ptr<std::atomic<bool>[]> _warningSentPerController;
+    std::mutex _transmitMutex;
+    bool _useCompactEncoding{};
+};
 
 template <typename T>
 class ShmRingBuffer final {
@@ -405,13 +1036,13 @@ public:
         return _size == _capacity;
     }
 
-    void PushBack(T&& element) {
+    // Returns the next slot with its old content, so large items are only partially overwritten instead of copied
+    [[nodiscard]] T& PushBackSlot() {
         if (IsFull()) {
             throw std::runtime_error("SHM ring buffer is full.");
         }
 
-        const uint32_t currentWriteIndex = _writeIndex;
-        _items[currentWriteIndex] = std::move(element);
+        T& item = _items[_writeIndex];
 
         ++_writeIndex;
         if (_writeIndex == _capacity) {
@@ -419,6 +1050,7 @@ public:
         }
 
         ++_size;
+        return item;
     }
 
     [[nodiscard]] T& PopFront() {
@@ -488,6 +1120,15 @@ protected:
 
         _messageBuffer->Initialize(static_cast<uint32_t>(totalQueueItemsCountPerBuffer));
 
+        // The extra slot keeps the data of the last received skipped message valid, while further messages of its
+        // controller are skipped
+        std::vector<uint32_t> queueSizes;
+        for (const Extension* extension : Base::_controllersByIndex) {
+            queueSizes.push_back(extension->info.queueSize + 1);
+        }
+
+        _skippedMessages.Initialize(queueSizes);
+
         ClearDataInternal();
     }
 
@@ -505,6 +1146,8 @@ protected:
         if (_messageBuffer) {
             _messageBuffer->Clear();
         }
+
+        _skippedMessages.Clear();
     }
 
     [[nodiscard]] bool TransmitInternal(const TMessageExtern& messageExtern) override {
@@ -521,35 +1164,66 @@ protected:
             return false;
         }
 
-        auto message = static_cast<TMessage>(messageExtern);
-
-        _messageBuffer->PushBack(std::move(message));
+        messageExtern.CheckMaxLength();
+        WriteTo(messageExtern, _messageBuffer->PushBackSlot());
         messageCount.fetch_add(1);
         return true;
     }
 
     [[nodiscard]] bool ReceiveInternal(TMessageExtern& messageExtern) override {
-        if (_totalReceiveCount == 0) {
-            return false;
+        // Skipped messages are older than all messages in the shared memory
+        if (!_skippedMessages.IsEmpty()) {
+            const size_t controllerIndex = _skippedMessages.PopFront(messageExtern);
+            _messageCountPerController[controllerIndex].fetch_sub(1);
+            return true;
         }
 
-        TMessage& message = _messageBuffer->PopFront();
-        WriteTo(message, messageExtern);
+        Extension* extension{};
+        TMessage* message = PopAcceptedMessage(extension);
+        if (message == nullptr) {
+            return false;
+        }
 
-        Extension& extension = Base::FindController(messageExtern.controllerId);
-        std::atomic<uint32_t>& receiveCount = _messageCountPerController[extension.controllerIndex];
-        receiveCount.fetch_sub(1);
-        _totalReceiveCount--;
+        WriteTo(*message, messageExtern);
+        _messageCountPerController[extension->controllerIndex].fetch_sub(1);
         return true;
     }
 
-    [[nodiscard]] bool SerializeInternal(ChannelWriter& writer) override {
+    [[nodiscard]] bool ReceiveInternal(const Extension& extension, TMessageExtern& messageExtern) override {
+        const size_t controllerIndex = extension.controllerIndex;
+        if (_skippedMessages.Size(controllerIndex) > 0) {
+            _skippedMessages.PopFront(controllerIndex, messageExtern);
+            _messageCountPerController[controllerIndex].fetch_sub(1);
+            return true;
+        }
+
+        Extension* messageExtension{};
+        while (TMessage* message = PopAcceptedMessage(messageExtension)) {
+            const size_t messageControllerIndex = messageExtension->controllerIndex;
+            if (messageControllerIndex == controllerIndex) {
+                WriteTo(*message, messageExtern);
+                _messageCountPerController[controllerIndex].fetch_sub(1);
+                return true;
+            }
+
+            // The message stays counted, so the sender cannot queue more messages than the skipped queue can hold
+            TMessageExtern skippedMessage{};
+            WriteTo(*message, skippedMessage);
+            _skippedMessages.PushBack(messageControllerIndex, skippedMessage);
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool SerializeInternal(ChannelWriter& writer,
+                                         [[maybe_unused]] const SimulationTime referenceTime) override {
         CheckResultWithMessage(writer.Write<uint32_t>(_messageBuffer->Size()), "Could not write transmit count.");
         return true;
     }
 
     [[nodiscard]] bool DeserializeInternal(ChannelReader& reader,
                                            SimulationTime simulationTime,
+                                           [[maybe_unused]] SimulationTime referenceTime,
                                            const typename Base::Callback& callback) override {
         uint32_t receiveCount{};
         CheckResultWithMessage(reader.Read(receiveCount), "Could not read receive count.");
@@ -559,43 +1233,60 @@ protected:
             return true;
         }
 
-        while (_totalReceiveCount > 0) {
-            TMessage& message = _messageBuffer->PopFront();
-
+        Extension* extension{};
+        while (TMessage* message = PopAcceptedMessage(extension)) {
             if (IsProtocolTracingEnabled()) {
-                LogProtocolDataTrace(ToString(message));
+                LogProtocolDataTrace(ToString(*message));
             }
 
-            Extension& extension = Base::FindController(message.controllerId);
-            std::atomic<uint32_t>& receiveCountPerController = _messageCountPerController[extension.controllerIndex];
-            receiveCountPerController.fetch_sub(1);
-            _totalReceiveCount--;
+            _messageCountPerController[extension->controllerIndex].fetch_sub(1);
 
-            callback(simulationTime, extension.info, static_cast<TMessageExtern>(message));
+            callback(simulationTime, extension->info, static_cast<TMessageExtern>(*message));
         }
 
         return true;
     }
 
 private:
+    // Rejected messages are dropped directly from the shared memory without being copied
+    [[nodiscard]] TMessage* PopAcceptedMessage(Extension*& extension) {
+        while (_totalReceiveCount > 0) {
+            TMessage& message = _messageBuffer->PopFront();
+            _totalReceiveCount--;
+
+            extension = &Base::FindController(message.controllerId);
+            if (Base::IsAccepted(*extension, message)) {
+                return &message;
+            }
+
+            _messageCountPerController[extension->controllerIndex].fetch_sub(1);
+        }
+
+        return nullptr;
+    }
+
     uint32_t _totalReceiveCount{};
     std::atomic<uint32_t>* _messageCountPerController{};
     ShmRingBuffer<TMessage>* _messageBuffer{};
 
+    // Messages of other controllers, which were popped from the shared memory while receiving for one controller.
+    // Ethernet messages are kept in containers as well, since the data of a received message must not move
+    ControllerMessageQueues<ContainerMessageQueue<TMessage, TMessageExtern>, TMessageExtern> _skippedMessages;
+
     SharedMemory _sharedMemory;
 };
 
-#endif
-
-#ifdef _WIN32
 using LocalCanBuffer = LocalBusProtocolBuffer<CanMessageContainer, CanMessage, CanController>;
 using LocalEthBuffer = LocalBusProtocolBuffer<EthMessageContainer, EthMessage, EthController>;
 using LocalLinBuffer = LocalBusProtocolBuffer<LinMessageContainer, LinMessage, LinController>;
-#endif
 
-using RemoteCanBuffer = RemoteBusProtocolBuffer<CanMessageContainer, CanMessage, CanController>;
-using RemoteEthBuffer = RemoteBusProtocolBuffer<EthMessageContainer, EthMessage, EthController>;
-using RemoteLinBuffer = RemoteBusProtocolBuffer<LinMessageContainer, LinMessage, LinController>;
+using RemoteCanBuffer = RemoteBusProtocolBuffer<CanMessageQueue, CanMessage, CanController>;
+using RemoteEthBuffer = RemoteBusProtocolBuffer<EthMessageQueue, EthMessage, EthController>;
+using RemoteLinBuffer = RemoteBusProtocolBuffer<LinMessageQueue, LinMessage, LinController>;
+
+// Ethernet messages keep the arena queue, since the lock-free ring would hold a maximum sized frame per slot
+using RemoteTransmitCanBuffer = RemoteTransmitBusProtocolBuffer<CanMessageContainer, CanMessage, CanController>;
+using RemoteTransmitLinBuffer = RemoteTransmitBusProtocolBuffer<LinMessageContainer, LinMessage, LinController>;
 
 class BusBufferImpl final : public BusBuffer {
     using CanBufferBase = BusProtocolBufferBase<CanMessage, CanController>;
@@ -604,12 +1295,12 @@ class BusBufferImpl final : public BusBuffer {
 
 public:
     BusBufferImpl(const CoSimType coSimType,
-                  [[maybe_unused]] const ConnectionKind connectionKind,
+                  const ConnectionKind connectionKind,
+                  const uint32_t protocolVersion,
                   const std::string& name,
                   const std::vector<CanController>& canControllers,
                   const std::vector<EthController>& ethControllers,
                   const std::vector<LinController>& linControllers) {
-#ifdef _WIN32
         if (connectionKind == ConnectionKind::Local) {
             _canTransmitBuffer = std::make_unique<LocalCanBuffer>();
             _ethTransmitBuffer = std::make_unique<LocalEthBuffer>();
@@ -619,17 +1310,21 @@ public:
             _ethReceiveBuffer = std::make_unique<LocalEthBuffer>();
             _linReceiveBuffer = std::make_unique<LocalLinBuffer>();
         } else {
-#endif
-            _canTransmitBuffer = std::make_unique<RemoteCanBuffer>();
-            _ethTransmitBuffer = std::make_unique<RemoteEthBuffer>();
-            _linTransmitBuffer = std::make_unique<RemoteLinBuffer>();
+            const bool useCompactEncoding = protocolVersion >= CoSimProtocolVersion1_4;
+            if (coSimType == CoSimType::Client) {
+                _canTransmitBuffer = std::make_unique<RemoteTransmitCanBuffer>(useCompactEncoding);
+                _linTransmitBuffer = std::make_unique<RemoteTransmitLinBuffer>(useCompactEncoding);
+            } else {
+                _canTransmitBuffer = std::make_unique<RemoteCanBuffer>(useCompactEncoding);
+                _linTransmitBuffer = std::make_unique<RemoteLinBuffer>(useCompactEncoding);
+            }
+
+            _ethTransmitBuffer = std::make_unique<RemoteEthBuffer>(useCompactEncoding);
 
-            _canReceiveBuffer = std::make_unique<RemoteCanBuffer>();
-            _ethReceiveBuffer = std::make_unique<RemoteEthBuffer>();
-            _linReceiveBuffer = std::make_unique<RemoteLinBuffer>();
-#ifdef _WIN32
+            _canReceiveBuffer = std::make_unique<RemoteCanBuffer>(useCompactEncoding);
+            _ethReceiveBuffer = std::make_unique<RemoteEthBuffer>(useCompactEncoding);
+            _linReceiveBuffer = std::make_unique<RemoteLinBuffer>(useCompactEncoding);
         }
-#endif
 
         const std::string suffixForTransmit = coSimType == CoSimType::Client ? "Transmit" : "Receive";
         const std::string suffixForReceive = coSimType == CoSimType::Client ? "Receive" : "Transmit";
@@ -660,6 +1355,16 @@ public:
         _linReceiveBuffer->ClearData();
     }
 
+    void SetCanAcceptanceFilter(const BusControllerId controllerId,
+                                const std::vector<BusMessageIdFilter>& filters) const override {
+        _canReceiveBuffer->SetAcceptanceFilter(controllerId, filters);
+    }
+
+    void SetLinAcceptanceFilter(const BusControllerId controllerId,
+                                const std::vector<BusMessageIdFilter>& filters) const override {
+        _linReceiveBuffer->SetAcceptanceFilter(controllerId, filters);
+    }
+
     [[nodiscard]] bool Transmit(const CanMessage& message) const override {
         return _canTransmitBuffer->Transmit(message);
     }
@@ -684,24 +1389,82 @@ public:
         return _linReceiveBuffer->Receive(message);
     }
 
-    [[nodiscard]] bool Serialize(ChannelWriter& writer) const override {
-        CheckResultWithMessage(_canTransmitBuffer->Serialize(writer), "Could not transmit CAN messages.");
-        CheckResultWithMessage(_ethTransmitBuffer->Serialize(writer), "Could not transmit ETH messages.");
-        CheckResultWithMessage(_linTransmitBuffer->Serialize(writer), "Could not transmit LIN messages.");
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, CanMessage& message) const override {
+        return _canReceiveBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, EthMessage& message) const override {
+        return _ethReceiveBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, LinMessage& message) const override {
+        return _linReceiveBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const CanMessage* messages, const uint32_t count) const override {
+        return _canTransmitBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const EthMessage* messages, const uint32_t count) const override {
+        return _ethTransmitBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const LinMessage* messages, const uint32_t count) const override {
+        return _linTransmitBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(CanMessage* messages, const uint32_t maxCount) const override {
+        return _canReceiveBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(EthMessage* messages, const uint32_t maxCount) const override {
+        return _ethReceiveBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(LinMessage* messages, const uint32_t maxCount) const override {
+        return _linReceiveBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       CanMessage* messages,
+                                       const uint32_t maxCount) const override {
+        return _canReceiveBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       EthMessage* messages,
+                                       const uint32_t maxCount) const override {
+        return _ethReceiveBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       LinMessage* messages,
+                                       const uint32_t maxCount) const override {
+        return _linReceiveBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    [[nodiscard]] bool Serialize(ChannelWriter& writer, const SimulationTime referenceTime) const override {
+        CheckResultWithMessage(_canTransmitBuffer->Serialize(writer, referenceTime),
+                               "Could not transmit CAN messages.");
+        CheckResultWithMessage(_ethTransmitBuffer->Serialize(writer, referenceTime),
+                               "Could not transmit ETH messages.");
+        CheckResultWithMessage(_linTransmitBuffer->Serialize(writer, referenceTime),
+                               "Could not transmit LIN messages.");
         return true;
     }
 
     [[nodiscard]] bool Deserialize(ChannelReader& reader,
                                    const SimulationTime simulationTime,
+                                   const SimulationTime referenceTime,
                                    const Callbacks& callbacks) const override {
         CheckResultWithMessage(
-            _canReceiveBuffer->Deserialize(reader, simulationTime, callbacks.canMessageReceivedCallback),
+            _canReceiveBuffer->Deserialize(reader, simulationTime, referenceTime, callbacks.canMessageReceivedCallback),
             "Could not receive CAN messages.");
         CheckResultWithMessage(
-            _ethReceiveBuffer->Deserialize(reader, simulationTime, callbacks.ethMessageReceivedCallback),
+            _ethReceiveBuffer->Deserialize(reader, simulationTime, referenceTime, callbacks.ethMessageReceivedCallback),
             "Could not receive ETH messages.");
         CheckResultWithMessage(
-            _linReceiveBuffer->Deserialize(reader, simulationTime, callbacks.linMessageReceivedCallback),
+            _linReceiveBuffer->Deserialize(reader, simulationTime, referenceTime, callbacks.linMessageReceivedCallback),
             "Could not receive LIN messages.");
         return true;
     }
@@ -720,12 +1483,14 @@ private:
 
 [[nodiscard]] std::unique_ptr<BusBuffer> CreateBusBuffer(CoSimType coSimType,
                                                          ConnectionKind connectionKind,
+                                                         uint32_t protocolVersion,
                                                          const std::string& name,
                                                          const std::vector<CanController>& canControllers,
                                                          const std::vector<EthController>& ethControllers,
                                                          const std::vector<LinController>& linControllers) {
     return std::make_unique<BusBufferImpl>(coSimType,
                                            connectionKind,
+                                           protocolVersion,
                                            name,
                                            canControllers,
                                            ethControllers,
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -17,6 +18,12 @@ public:
 
     virtual void ClearData() const = 0;
 
+    // Received messages, which are rejected by the filter of their controller, are dropped before they are queued
+    virtual void SetCanAcceptanceFilter(BusControllerId controllerId,
+                                        const std::vector<BusMessageIdFilter>& filters) const = 0;
+    virtual void SetLinAcceptanceFilter(BusControllerId controllerId,
+                                        const std::vector<BusMessageIdFilter>& filters) const = 0;
+
     [[nodiscard]] virtual bool Transmit(const CanMessage& message) const = 0;
     [[nodiscard]] virtual bool Transmit(const EthMessage& message) const = 0;
     [[nodiscard]] virtual bool Transmit(const LinMessage& message) const = 0;
@@ -25,14 +32,42 @@ public:
     [[nodiscard]] virtual bool Receive(EthMessage& message) const = 0;
     [[nodiscard]] virtual bool Receive(LinMessage& message) const = 0;
 
-    [[nodiscard]] virtual bool Serialize(ChannelWriter& writer) const = 0;
+    // Only receive messages of the given controller. Messages of other controllers stay queued
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, CanMessage& message) const = 0;
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, EthMessage& message) const = 0;
+    [[nodiscard]] virtual bool Receive(BusControllerId controllerId, LinMessage& message) const = 0;
+
+    // Handle a whole batch with one lock and return how many messages were transmitted or received
+    [[nodiscard]] virtual uint32_t TransmitMany(const CanMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const EthMessage* messages, uint32_t count) const = 0;
+    [[nodiscard]] virtual uint32_t TransmitMany(const LinMessage* messages, uint32_t count) const = 0;
+
+    [[nodiscard]] virtual uint32_t ReceiveMany(CanMessage* messages, uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(EthMessage* messages, uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(LinMessage* messages, uint32_t maxCount) const = 0;
+
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               CanMessage* messages,
+                                               uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               EthMessage* messages,
+                                               uint32_t maxCount) const = 0;
+    [[nodiscard]] virtual uint32_t ReceiveMany(BusControllerId controllerId,
+                                               LinMessage* messages,
+                                               uint32_t maxCount) const = 0;
+
+    // Message timestamps are encoded relative to the reference time, which both sides must agree on.
+    // The simulation time is only passed to the receive callbacks
+    [[nodiscard]] virtual bool Serialize(ChannelWriter& writer, SimulationTime referenceTime) const = 0;
     [[nodiscard]] virtual bool Deserialize(ChannelReader& reader,
                                            SimulationTime simulationTime,
+                                           SimulationTime referenceTime,
                                            const Callbacks& callbacks) const = 0;
 };
 
 [[nodiscard]] std::unique_ptr<BusBuffer> CreateBusBuffer(CoSimType coSimType,
                                                          ConnectionKind connectionKind,
+                                                         uint32_t protocolVersion,
                                                          const std::string& name,
                                                          const std::vector<CanController>& canControllers,
                                                          const std::vector<EthController>& ethControllers,
@@ -3,6 +3,7 @@
 #include "DsVeosCoSim/CoSimClient.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -13,6 +14,7 @@
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "IoBuffer.h"
+#include "LatencyHistogram.h"
 #include "PortMapper.h"
 #include "Protocol.h"
 
@@ -28,6 +30,28 @@ enum class ResponderMode {
     NonBlocking
 };
 
+[[nodiscard]] Command GetRoundTripCommand(const FrameKind frameKind) {
+    switch (frameKind) {
+        case FrameKind::Step:
+        case FrameKind::StepN:
+            return Command::Step;
+        case FrameKind::Start:
+            return Command::Start;
+        case FrameKind::Stop:
+            return Command::Stop;
+        case FrameKind::Terminate:
+            return Command::Terminate;
+        case FrameKind::Pause:
+            return Command::Pause;
+        case FrameKind::Continue:
+            return Command::Continue;
+        case FrameKind::Ping:
+            return Command::Ping;
+        default:
+            return Command::None;
+    }
+}
+
 class CoSimClientImpl final : public CoSimClient {
 public:
     CoSimClientImpl() = default;
@@ -54,6 +78,19 @@ public:
         _serverName = connectConfig.serverName;
         _clientName = connectConfig.clientName;
         _remotePort = connectConfig.remotePort;
+        _tcpSocketOptions = connectConfig.tcpSocketOptions;
+        _mode = {};
+        if (connectConfig.enablePipelinedSteps) {
+            _mode |= Mode::PipelinedSteps;
+        }
+
+        if (connectConfig.enableStepN) {
+            _mode |= Mode::StepN;
+        }
+
+        if (connectConfig.enableCompression) {
+            _mode |= Mode::Compression;
+        }
 
         if (!connectConfig.serverName.empty() && _remoteIpAddress.empty() && (connectConfig.remotePort == 0)) {
             if (!LocalConnect()) {
@@ -64,6 +101,8 @@ public:
             CheckResult(RemoteConnect());
         }
 
+        _channel->SetWaitMode(connectConfig.waitMode, std::chrono::microseconds(connectConfig.spinTimeInMicroseconds));
+
         // Co-Sim connect
         CheckResult(SendConnectRequest());
         CheckResultWithMessage(ReceiveConnectResponse(), "Could not receive connect response.");
@@ -240,6 +279,48 @@ public:
         _ioBuffer->Read(incomingSignalId, length, value);
     }
 
+    void WriteSignals(const uint32_t outgoingSignalsCount, const IoSignalWriteValue* outgoingSignals) const override {
+        EnsureIsConnected();
+
+        _ioBuffer->WriteSignals(outgoingSignalsCount, outgoingSignals);
+    }
+
+    void ReadSignals(const uint32_t incomingSignalsCount, IoSignalReadValue* incomingSignals) const override {
+        EnsureIsConnected();
+
+        _ioBuffer->ReadSignals(incomingSignalsCount, incomingSignals);
+    }
+
+    [[nodiscard]] IoSignalHandle GetIncomingSignalHandle(const IoSignalId incomingSignalId) const override {
+        EnsureIsConnected();
+
+        return _ioBuffer->GetReadSignalHandle(incomingSignalId);
+    }
+
+    [[nodiscard]] IoSignalHandle GetOutgoingSignalHandle(const IoSignalId outgoingSignalId) const override {
+        EnsureIsConnected();
+
+        return _ioBuffer->GetWriteSignalHandle(outgoingSignalId);
+    }
+
+    void WriteFast(const IoSignalHandle outgoingSignalHandle, const uint32_t length, const void* value) const override {
+        EnsureIsConnected();
+
+        _ioBuffer->WriteFast(outgoingSignalHandle, length, value);
+    }
+
+    void ReadFast(const IoSignalHandle incomingSignalHandle, uint32_t& length, void* value) const override {
+        EnsureIsConnected();
+
+        _ioBuffer->ReadFast(incomingSignalHandle, length, value);
+    }
+
+    void ReadFast(const IoSignalHandle incomingSignalHandle, uint32_t& length, const void** value) const override {
+        EnsureIsConnected();
+
+        _ioBuffer->ReadFast(incomingSignalHandle, length, value);
+    }
+
     void GetCanControllers(uint32_t* controllersCount, const CanController** controllers) const override {
         EnsureIsConnected();
 
@@ -315,6 +396,107 @@ public:
         return _busBuffer->Receive(message);
     }
 
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, CanMessage& message) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, EthMessage& message) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] bool Receive(const BusControllerId controllerId, LinMessage& message) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->Receive(controllerId, message);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const CanMessage* messages, const uint32_t count) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const EthMessage* messages, const uint32_t count) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const LinMessage* messages, const uint32_t count) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->TransmitMany(messages, count);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(CanMessage* messages, const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(EthMessage* messages, const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(LinMessage* messages, const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       CanMessage* messages,
+                                       const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       EthMessage* messages,
+                                       const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    [[nodiscard]] uint32_t ReceiveMany(const BusControllerId controllerId,
+                                       LinMessage* messages,
+                                       const uint32_t maxCount) const override {
+        EnsureIsConnected();
+
+        return _busBuffer->ReceiveMany(controllerId, messages, maxCount);
+    }
+
+    void SetCanAcceptanceFilter(const BusControllerId controllerId,
+                                const std::vector<BusMessageIdFilter>& filters) const override {
+        EnsureIsConnected();
+
+        _busBuffer->SetCanAcceptanceFilter(controllerId, filters);
+    }
+
+    void SetLinAcceptanceFilter(const BusControllerId controllerId,
+                                const std::vector<BusMessageIdFilter>& filters) const override {
+        EnsureIsConnected();
+
+        _busBuffer->SetLinAcceptanceFilter(controllerId, filters);
+    }
+
+    [[nodiscard]] LatencyStatistics GetLatencyStatistics(const Command command,
+                                                         const LatencyPhase phase) const override {
+        return _latencyRecorder.GetStatistics(command, phase);
+    }
+
+    void ResetLatencyStatistics() override {
+        _latencyRecorder.Reset();
+    }
+
 private:
     void ResetDataFromPreviousConnect() {
         _responderMode = {};
@@ -322,6 +504,8 @@ private:
         _isConnected = {};
         _currentSimulationTime = {};
         _nextSimulationTime = {};
+        _stepSimulationTime = {};
+        _remainingStepCount = {};
         _nextCommand.exchange({});
         _callbacks = {};
         if (_channel) {
@@ -341,11 +525,7 @@ private:
     }
 
     [[nodiscard]] bool LocalConnect() {
-#ifdef _WIN32
         _channel = TryConnectToLocalChannel(_serverName);
-#else
-        _channel = TryConnectToUdsChannel(_serverName);
-#endif
         if (!_channel) {
             LogTrace("Could not connect to local dSPACE VEOS CoSim server '" + _serverName + "'.");
             return false;
@@ -371,7 +551,11 @@ private:
                     std::to_string(_remotePort) + "...");
         }
 
-        _channel = TryConnectToTcpChannel(_remoteIpAddress, _remotePort, _localPort, ClientTimeoutInMilliseconds);
+        _channel = TryConnectToTcpChannel(_remoteIpAddress,
+                                          _remotePort,
+                                          _localPort,
+                                          ClientTimeoutInMilliseconds,
+                                          _tcpSocketOptions);
         CheckResultWithMessage(_channel, "Could not connect to dSPACE VEOS CoSim server.");
 
         _connectionKind = ConnectionKind::Remote;
@@ -381,7 +565,7 @@ private:
 
     [[nodiscard]] bool SendConnectRequest() const {
         CheckResultWithMessage(
-            Protocol::SendConnect(_channel->GetWriter(), CoSimProtocolVersion, {}, _serverName, _clientName),
+            Protocol::SendConnect(_channel->GetWriter(), CoSimProtocolVersion, _mode, _serverName, _clientName),
             "Could not send connect frame.");
         return true;
     }
@@ -409,6 +593,10 @@ private:
         _ethControllersExtern = Convert(_ethControllers);
         _linControllersExtern = Convert(_linControllers);
 
+        if (HasFlag(mode, Mode::PipelinedSteps)) {
+            LogTrace("dSPACE VEOS CoSim server runs steps pipelined.");
+        }
+
         if (_connectionKind == ConnectionKind::Local) {
             LogInfo("Connected to local dSPACE VEOS CoSim server '" + _serverName + "'.");
         } else {
@@ -421,15 +609,31 @@ private:
             }
         }
 
+        const uint32_t protocolVersion = NegotiateProtocolVersion(serverProtocolVersion);
+        if (protocolVersion >= CoSimProtocolVersion1_3) {
+            _channel->EnableLargeFrames();
+        }
+
+        if (HasFlag(mode, Mode::Compression)) {
+            _channel->EnableCompression();
+        }
+
+        std::string bufferName = _serverName;
+        if ((_connectionKind == ConnectionKind::Local) && (protocolVersion >= CoSimProtocolVersion1_2)) {
+            bufferName = _channel->GetName();
+        }
+
         _ioBuffer = CreateIoBuffer(CoSimType::Client,
                                    _connectionKind,
-                                   _serverName,
+                                   protocolVersion,
+                                   bufferName,
                                    _incomingSignalsExtern,
                                    _outgoingSignalsExtern);
 
         _busBuffer = CreateBusBuffer(CoSimType::Client,
                                      _connectionKind,
-                                     _serverName,
+                                     protocolVersion,
+                                     bufferName,
                                      _canControllersExtern,
                                      _ethControllersExtern,
                                      _linControllersExtern);
@@ -442,6 +646,7 @@ private:
     [[nodiscard]] bool OnConnectError() const {
         std::string errorString;
         CheckResultWithMessage(Protocol::ReadError(_channel->GetReader(), errorString), "Could not read error frame.");
+        LogError(errorString);
         return false;
     }
 
@@ -464,70 +669,52 @@ private:
     [[nodiscard]] bool RunCallbackBasedCoSimulationInternal() {
         while (_isConnected) {
             FrameKind frameKind{};
-            CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+            CheckResult(ReceiveHeader(frameKind));
 
             switch (frameKind) {
-                case FrameKind::Step: {
-                    CheckResultWithMessage(OnStep(), "Could not handle step.");
+                case FrameKind::Step:
+                case FrameKind::StepN: {
+                    if (frameKind == FrameKind::Step) {
+                        CheckResultWithMessage(OnStep(), "Could not handle step.");
+                    } else {
+                        CheckResultWithMessage(OnStepN(), "Could not handle step n.");
+                    }
+
+                    while (_isConnected && (_remainingStepCount > 0)) {
+                        RunInternalStep();
+                    }
+
+                    _latencyRecorder.Record(Command::Step, LatencyPhase::Callback, _latencyStart);
                     if (!_isConnected) {
                         return true;
                     }
 
-                    const Command nextCommand = _nextCommand.exchange({});
-                    CheckResultWithMessage(Protocol::SendStepOk(_channel->GetWriter(),
-                                                                _nextSimulationTime,
-                                                                nextCommand,
-                                                                *_ioBuffer,
-                                                                *_busBuffer),
-                                           "Could not send step ok frame.");
+                    CheckResult(SendStepOk());
                     break;
                 }
                 case FrameKind::Start:
                     CheckResultWithMessage(OnStart(), "Could not handle start.");
-                    if (!_isConnected) {
-                        return true;
-                    }
-
-                    CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                    CheckResult(FinishBlockingCommand(Command::Start));
                     break;
                 case FrameKind::Stop:
                     CheckResultWithMessage(OnStop(), "Could not handle stop.");
-                    if (!_isConnected) {
-                        return true;
-                    }
-
-                    CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                    CheckResult(FinishBlockingCommand(Command::Stop));
                     break;
                 case FrameKind::Terminate:
                     CheckResultWithMessage(OnTerminate(), "Could not handle terminate.");
-                    if (!_isConnected) {
-                        return true;
-                    }
-
-                    CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                    CheckResult(FinishBlockingCommand(Command::Terminate));
                     break;
                 case FrameKind::Pause:
                     CheckResultWithMessage(OnPause(), "Could not handle pause.");
-                    if (!_isConnected) {
-                        return true;
-                    }
-
-                    CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                    CheckResult(FinishBlockingCommand(Command::Pause));
                     break;
                 case FrameKind::Continue:
                     CheckResultWithMessage(OnContinue(), "Could not handle continue.");
-                    if (!_isConnected) {
-                        return true;
-                    }
-
-                    CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                    CheckResult(FinishBlockingCommand(Command::Continue));
                     break;
-                case FrameKind::Ping: {
-                    const Command nextCommand = _nextCommand.exchange({});
-                    CheckResultWithMessage(Protocol::SendPingOk(_channel->GetWriter(), nextCommand),
-                                           "Could not send ping ok frame.");
+                case FrameKind::Ping:
+                    CheckResult(SendPingOk());
                     break;
-                }
                 default:
                     throw CoSimException("Received unexpected frame " + ToString(frameKind) + ".");
             }
@@ -536,18 +723,79 @@ private:
         return true;
     }
 
+    // The callback may have disconnected the client, so the ok frame is only sent if it is still connected
+    [[nodiscard]] bool FinishBlockingCommand(const Command command) {
+        _latencyRecorder.Record(command, LatencyPhase::Callback, _latencyStart);
+        if (!_isConnected) {
+            return true;
+        }
+
+        return SendOk(command);
+    }
+
+    [[nodiscard]] bool ReceiveHeader(FrameKind& frameKind) {
+        _latencyStart = LatencyRecorder::Clock::now();
+        CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+        _latencyRecorder.Record(GetRoundTripCommand(frameKind), LatencyPhase::Wait, _latencyStart);
+        return true;
+    }
+
+    [[nodiscard]] bool SendOk(const Command command) {
+        CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+        _latencyRecorder.Record(command, LatencyPhase::Send, _latencyStart);
+        return true;
+    }
+
+    [[nodiscard]] bool SendPingOk() {
+        const Command nextCommand = _nextCommand.exchange({});
+        CheckResultWithMessage(Protocol::SendPingOk(_channel->GetWriter(), nextCommand),
+                               "Could not send ping ok frame.");
+        _latencyRecorder.Record(Command::Ping, LatencyPhase::Send, _latencyStart);
+        return true;
+    }
+
+    [[nodiscard]] bool SendStepOk() {
+        const Command nextCommand = _nextCommand.exchange({});
+        ChannelWriter& writer = _channel->GetWriter();
+        CheckResultWithMessage(Protocol::WriteStepOk(writer,
+                                                     _stepSimulationTime,
+                                                     _nextSimulationTime,
+                                                     nextCommand,
+                                                     *_ioBuffer,
+                                                     *_busBuffer),
+                               "Could not write step ok frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Serialize, _latencyStart);
+        CheckResultWithMessage(writer.EndWrite(), "Could not send step ok frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Send, _latencyStart);
+        return true;
+    }
+
     [[nodiscard]] bool PollCommandInternal(SimulationTime& simulationTime, Command& command, const bool returnOnPing) {
+        // The remaining steps of a step n frame are handed out without receiving a frame
+        if (_remainingStepCount > 0) {
+            _latencyStart = LatencyRecorder::Clock::now();
+            RunInternalStep();
+            _currentCommand = Command::Step;
+            simulationTime = _currentSimulationTime;
+            command = _currentCommand;
+            return true;
+        }
+
         simulationTime = _currentSimulationTime;
         command = Command::Terminate;
 
         while (true) {
             FrameKind frameKind{};
-            CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+            CheckResult(ReceiveHeader(frameKind));
             switch (frameKind) {
                 case FrameKind::Step:
                     CheckResultWithMessage(OnStep(), "Could not handle step.");
                     _currentCommand = Command::Step;
                     break;
+                case FrameKind::StepN:
+                    CheckResultWithMessage(OnStepN(), "Could not handle step n.");
+                    _currentCommand = Command::Step;
+                    break;
                 case FrameKind::Start:
                     CheckResultWithMessage(OnStart(), "Could not handle start.");
                     _currentCommand = Command::Start;
@@ -579,9 +827,7 @@ private:
                 break;
             }
 
-            const Command nextCommand = _nextCommand.exchange({});
-            CheckResultWithMessage(Protocol::SendPingOk(_channel->GetWriter(), nextCommand),
-                                   "Could not send ping ok frame.");
+            CheckResult(SendPingOk());
         }
 
         simulationTime = _currentSimulationTime;
@@ -591,6 +837,11 @@ private:
     }
 
     [[nodiscard]] bool FinishCommandInternal() {
+        // In polling mode the time between PollCommand and FinishCommand is spent by the caller
+        const Command roundTripCommand =
+            (_currentCommand == Command::TerminateFinished) ? Command::Terminate : _currentCommand;
+        _latencyRecorder.Record(roundTripCommand, LatencyPhase::Callback, _latencyStart);
+
         switch (_currentCommand) {
             case Command::Start:
             case Command::Stop:
@@ -598,24 +849,19 @@ private:
             case Command::TerminateFinished:
             case Command::Pause:
             case Command::Continue:
-                CheckResultWithMessage(Protocol::SendOk(_channel->GetWriter()), "Could not send ok frame.");
+                CheckResult(SendOk(roundTripCommand));
                 break;
-            case Command::Step: {
-                const Command nextCommand = _nextCommand.exchange({});
-                CheckResultWithMessage(Protocol::SendStepOk(_channel->GetWriter(),
-                                                            _nextSimulationTime,
-                                                            nextCommand,
-                                                            *_ioBuffer,
-                                                            *_busBuffer),
-                                       "Could not send step ok frame.");
+            case Command::Step:
+                // The step ok frame is only sent after the last step of a step n frame
+                if (_remainingStepCount > 0) {
+                    break;
+                }
+
+                CheckResult(SendStepOk());
                 break;
-            }
-            case Command::Ping: {
-                const Command nextCommand = _nextCommand.exchange({});
-                CheckResultWithMessage(Protocol::SendPingOk(_channel->GetWriter(), nextCommand),
-                                       "Could not send ping ok frame.");
+            case Command::Ping:
+                CheckResult(SendPingOk());
                 break;
-            }
             case Command::None:
                 break;
         }
@@ -629,6 +875,30 @@ private:
         CheckResultWithMessage(
             Protocol::ReadStep(_channel->GetReader(), _currentSimulationTime, *_ioBuffer, *_busBuffer, _callbacks),
             "Could not read step frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Deserialize, _latencyStart);
+        _stepSimulationTime = _currentSimulationTime;
+
+        if (_callbacks.simulationEndStepCallback) {
+            _callbacks.simulationEndStepCallback(_currentSimulationTime);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bool OnStepN() {
+        uint32_t stepCount{};
+        CheckResultWithMessage(Protocol::ReadStepN(_channel->GetReader(),
+                                                   _currentSimulationTime,
+                                                   stepCount,
+                                                   *_ioBuffer,
+                                                   *_busBuffer,
+                                                   _callbacks),
+                               "Could not read step n frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Deserialize, _latencyStart);
+
+        _remainingStepCount = (stepCount > 0) ? (stepCount - 1) : 0;
+        // The remaining steps advance the current simulation time, but the step ok frame refers to the first one
+        _stepSimulationTime = _currentSimulationTime;
 
         if (_callbacks.simulationEndStepCallback) {
             _callbacks.simulationEndStepCallback(_currentSimulationTime);
@@ -637,9 +907,23 @@ private:
         return true;
     }
 
+    void RunInternalStep() {
+        _remainingStepCount--;
+        _currentSimulationTime += _stepSize;
+
+        if (_callbacks.simulationBeginStepCallback) {
+            _callbacks.simulationBeginStepCallback(_currentSimulationTime);
+        }
+
+        if (_callbacks.simulationEndStepCallback) {
+            _callbacks.simulationEndStepCallback(_currentSimulationTime);
+        }
+    }
+
     [[nodiscard]] bool OnStart() {
         CheckResultWithMessage(Protocol::ReadStart(_channel->GetReader(), _currentSimulationTime),
                                "Could not read start frame.");
+        _latencyRecorder.Record(Command::Start, LatencyPhase::Deserialize, _latencyStart);
 
         _ioBuffer->ClearData();
         _busBuffer->ClearData();
@@ -654,6 +938,7 @@ private:
     [[nodiscard]] bool OnStop() {
         CheckResultWithMessage(Protocol::ReadStop(_channel->GetReader(), _currentSimulationTime),
                                "Could not read stop frame.");
+        _latencyRecorder.Record(Command::Stop, LatencyPhase::Deserialize, _latencyStart);
 
         if (_callbacks.simulationStoppedCallback) {
             _callbacks.simulationStoppedCallback(_currentSimulationTime);
@@ -666,6 +951,7 @@ private:
         TerminateReason reason{};
         CheckResultWithMessage(Protocol::ReadTerminate(_channel->GetReader(), _currentSimulationTime, reason),
                                "Could not read terminate frame.");
+        _latencyRecorder.Record(Command::Terminate, LatencyPhase::Deserialize, _latencyStart);
 
         if (_callbacks.simulationTerminatedCallback) {
             _callbacks.simulationTerminatedCallback(_currentSimulationTime, reason);
@@ -677,6 +963,7 @@ private:
     [[nodiscard]] bool OnPause() {
         CheckResultWithMessage(Protocol::ReadPause(_channel->GetReader(), _currentSimulationTime),
                                "Could not read pause frame.");
+        _latencyRecorder.Record(Command::Pause, LatencyPhase::Deserialize, _latencyStart);
 
         if (_callbacks.simulationPausedCallback) {
             _callbacks.simulationPausedCallback(_currentSimulationTime);
@@ -688,6 +975,7 @@ private:
     [[nodiscard]] bool OnContinue() {
         CheckResultWithMessage(Protocol::ReadContinue(_channel->GetReader(), _currentSimulationTime),
                                "Could not read continue frame.");
+        _latencyRecorder.Record(Command::Continue, LatencyPhase::Deserialize, _latencyStart);
 
         if (_callbacks.simulationContinuedCallback) {
             _callbacks.simulationContinuedCallback(_currentSimulationTime);
@@ -747,14 +1035,18 @@ private:
     Callbacks _callbacks{};
     SimulationTime _currentSimulationTime{};
     SimulationTime _nextSimulationTime{};
+    SimulationTime _stepSimulationTime{};
+    uint32_t _remainingStepCount{};
 
     SimulationTime _stepSize{};
 
     std::string _remoteIpAddress;
     std::string _serverName;
     std::string _clientName;
+    Mode _mode{};
     uint16_t _remotePort{};
     uint16_t _localPort{};
+    TcpSocketOptions _tcpSocketOptions{};
 
     ResponderMode _responderMode{};
     Command _currentCommand{};
@@ -774,6 +1066,9 @@ private:
 
     std::unique_ptr<IoBuffer> _ioBuffer;
     std::unique_ptr<BusBuffer> _busBuffer;
+
+    LatencyRecorder _latencyRecorder;
+    LatencyRecorder::Clock::time_point _latencyStart{};
 };
 
 }  // namespace
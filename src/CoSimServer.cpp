@@ -2,12 +2,14 @@
 
 #include "DsVeosCoSim/CoSimServer.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <exception>
 #include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "BusBuffer.h"
@@ -15,6 +17,7 @@
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "IoBuffer.h"
+#include "LatencyHistogram.h"
 #include "PortMapper.h"
 #include "Protocol.h"
 
@@ -24,6 +27,18 @@ namespace DsVeosCoSim {
 
 namespace {
 
+// The IO buffer uses the position in the signal list as handle, so it stays valid when a client reconnects
+[[nodiscard]] IoSignalHandle FindSignalHandle(const std::vector<IoSignalContainer>& signals,
+                                              const IoSignalId signalId) {
+    for (size_t i = 0; i < signals.size(); i++) {
+        if (signals[i].id == signalId) {
+            return static_cast<IoSignalHandle>(i);
+        }
+    }
+
+    throw CoSimException("IO signal id " + ToString(signalId) + " is unknown.");
+}
+
 class CoSimServerImpl final : public CoSimServer {
 public:
     CoSimServerImpl() = default;
@@ -38,10 +53,20 @@ public:
     CoSimServerImpl& operator=(CoSimServerImpl&&) = delete;
 
     void Load(const CoSimServerConfig& config) override {
+        if (config.maxClientCount == 0) {
+            throw CoSimException("CoSimServerConfig.maxClientCount must be at least 1.");
+        }
+
         _enableRemoteAccess = config.enableRemoteAccess;
         _localPort = config.port;
         _serverName = config.serverName;
         _isClientOptional = config.isClientOptional;
+        _maxClientCount = config.maxClientCount;
+        _enablePipelinedSteps = config.enablePipelinedSteps;
+        _enableCompression = config.enableCompression;
+        _waitMode = config.waitMode;
+        _spinTime = std::chrono::microseconds(config.spinTimeInMicroseconds);
+        _tcpSocketOptions = config.tcpSocketOptions;
         _stepSize = config.stepSize;
         _registerAtPortMapper = config.registerAtPortMapper;
         _incomingSignals = config.incomingSignals;
@@ -67,19 +92,21 @@ public:
     }
 
     void Unload() noexcept override {
-        if (_channel) {
-            _channel.reset();
-        }
+        _sessions.clear();
 
         StopAccepting();
 
+        if (_localChannelServer) {
+            _localChannelServer.reset();
+        }
+
         if (_portMapperServer) {
             _portMapperServer.reset();
         }
     }
 
     void Start(const SimulationTime simulationTime) override {
-        if (!_channel) {
+        if (_sessions.empty()) {
             if (_isClientOptional) {
                 return;
             }
@@ -87,136 +114,271 @@ public:
             LogInfo("Waiting for dSPACE VEOS CoSim client to connect to dSPACE VEOS CoSim server '" + _serverName +
                     "' ...");
 
-            while (!AcceptChannel()) {
+            std::unique_ptr<Channel> channel;
+            ConnectionKind connectionKind{};
+            while (!AcceptChannel(channel, connectionKind)) {
                 std::this_thread::sleep_for(milliseconds(1));
             }
 
-            if (!OnHandleConnect()) {
-                CloseConnection();
+            if (!AddSession(std::move(channel), connectionKind)) {
                 return;
             }
         }
 
-        if (!StartInternal(simulationTime)) {
-            CloseConnection();
-        }
+        FinishPendingSteps();
+
+        RunCommandOnAllSessions(Command::Start, [&](Session& session) {
+            // The client clears its data on start
+            session.ioBuffer->ResetChangedBlocks();
+
+            CheckResultWithMessage(Protocol::SendStart(session.channel->GetWriter(), simulationTime),
+                                   "Could not send start frame.");
+            return true;
+        });
     }
 
     void Stop(const SimulationTime simulationTime) override {
-        if (!_channel) {
-            return;
-        }
+        FinishPendingSteps();
 
-        if (!StopInternal(simulationTime)) {
-            CloseConnection();
-        }
+        RunCommandOnAllSessions(Command::Stop, [&](const Session& session) {
+            CheckResultWithMessage(Protocol::SendStop(session.channel->GetWriter(), simulationTime),
+                                   "Could not send stop frame.");
+            return true;
+        });
     }
 
     void Terminate(const SimulationTime simulationTime, const TerminateReason reason) override {
-        if (!_channel) {
-            return;
-        }
+        FinishPendingSteps();
 
-        if (!TerminateInternal(simulationTime, reason)) {
-            CloseConnection();
-        }
+        RunCommandOnAllSessions(Command::Terminate, [&](const Session& session) {
+            CheckResultWithMessage(Protocol::SendTerminate(session.channel->GetWriter(), simulationTime, reason),
+                                   "Could not send terminate frame.");
+            return true;
+        });
     }
 
     void Pause(const SimulationTime simulationTime) override {
-        if (!_channel) {
-            return;
-        }
+        FinishPendingSteps();
 
-        if (!PauseInternal(simulationTime)) {
-            CloseConnection();
-        }
+        RunCommandOnAllSessions(Command::Pause, [&](const Session& session) {
+            CheckResultWithMessage(Protocol::SendPause(session.channel->GetWriter(), simulationTime),
+                                   "Could not send pause frame.");
+            return true;
+        });
     }
 
     void Continue(const SimulationTime simulationTime) override {
-        if (!_channel) {
-            return;
-        }
+        FinishPendingSteps();
 
-        if (!ContinueInternal(simulationTime)) {
-            CloseConnection();
-        }
+        RunCommandOnAllSessions(Command::Continue, [&](const Session& session) {
+            CheckResultWithMessage(Protocol::SendContinue(session.channel->GetWriter(), simulationTime),
+                                   "Could not send continue frame.");
+            return true;
+        });
     }
 
     SimulationTime Step(const SimulationTime simulationTime) override {
-        if (!_channel) {
-            return {};
+        SimulationTime nextSimulationTime{};
+        std::vector<Command> commands;
+        RunOnAllSessions(
+            [&](Session& session) {
+                if (session.isPipelined) {
+                    return true;
+                }
+
+                CheckResultWithMessage(SendStep(session, simulationTime), "Could not send step frame.");
+                return true;
+            },
+            [&](Session& session) {
+                if (!session.isPipelined) {
+                    return ReceiveStepOk(session, nextSimulationTime, commands);
+                }
+
+                // The response to the previous step is consumed before the next step is sent, so both sides never
+                // write at the same time
+                if (session.hasPendingStep) {
+                    session.hasPendingStep = false;
+                    CheckResult(ReceiveStepOk(session, nextSimulationTime, commands));
+                }
+
+                CheckResultWithMessage(SendStep(session, simulationTime), "Could not send step frame.");
+                session.hasPendingStep = true;
+                return true;
+            });
+
+        HandlePendingCommands(Command::Step, commands);
+
+        return nextSimulationTime;
+    }
+
+    SimulationTime StepN(const SimulationTime simulationTime, const uint32_t stepCount) override {
+        if (stepCount == 0) {
+            throw CoSimException("Step count must be at least 1.");
         }
 
-        Command command{};
-        SimulationTime nextSimulationTime{};
-        if (!StepInternal(simulationTime, nextSimulationTime, command)) {
-            CloseConnection();
-            return {};
+        if (_stepSize == SimulationTime{}) {
+            throw CoSimException("StepN requires CoSimServerConfig.stepSize to be set.");
+        }
+
+        // Clients that need every step get them one by one
+        for (const Session& session : _sessions) {
+            if (!session.supportsStepN) {
+                SimulationTime nextSimulationTime{};
+                for (uint32_t i = 0; i < stepCount; i++) {
+                    nextSimulationTime = Step(simulationTime + (_stepSize * i));
+                }
+
+                return nextSimulationTime;
+            }
         }
 
-        HandlePendingCommand(command);
+        FinishPendingSteps();
+
+        SimulationTime nextSimulationTime{};
+        std::vector<Command> commands;
+        RunOnAllSessions(
+            [&](Session& session) {
+                CheckResultWithMessage(SendStepN(session, simulationTime, stepCount), "Could not send step n frame.");
+                return true;
+            },
+            [&](const Session& session) {
+                return ReceiveStepOk(session, nextSimulationTime, commands);
+            });
+
+        HandlePendingCommands(Command::Step, commands);
+
         return nextSimulationTime;
     }
 
     void Write(const IoSignalId signalId, const uint32_t length, const void* value) const override {
-        if (!_channel) {
-            return;
+        for (const Session& session : _sessions) {
+            session.ioBuffer->Write(signalId, length, value);
         }
-
-        _ioBuffer->Write(signalId, length, value);
     }
 
     void Read(const IoSignalId signalId, uint32_t& length, const void** value) const override {
-        if (!_channel) {
+        if (_sessions.empty()) {
             return;
         }
 
-        _ioBuffer->Read(signalId, length, value);
+        _sessions.front().ioBuffer->Read(signalId, length, value);
     }
 
-    [[nodiscard]] bool Transmit(const CanMessage& message) const override {
-        if (!_channel) {
-            return true;
+    void Read(const uint32_t clientId,
+              const IoSignalId signalId,
+              uint32_t& length,
+              const void** value) const override {
+        FindSession(clientId).ioBuffer->Read(signalId, length, value);
+    }
+
+    void WriteSignals(const uint32_t signalsCount, const IoSignalWriteValue* signals) const override {
+        for (const Session& session : _sessions) {
+            session.ioBuffer->WriteSignals(signalsCount, signals);
         }
+    }
 
-        return _busBuffer->Transmit(message);
+    void ReadSignals(const uint32_t signalsCount, IoSignalReadValue* signals) const override {
+        if (_sessions.empty()) {
+            return;
+        }
+
+        _sessions.front().ioBuffer->ReadSignals(signalsCount, signals);
     }
 
-    [[nodiscard]] bool Transmit(const EthMessage& message) const override {
-        if (!_channel) {
-            return true;
+    [[nodiscard]] IoSignalHandle GetIncomingSignalHandle(const IoSignalId signalId) const override {
+        return FindSignalHandle(_incomingSignals, signalId);
+    }
+
+    [[nodiscard]] IoSignalHandle GetOutgoingSignalHandle(const IoSignalId signalId) const override {
+        return FindSignalHandle(_outgoingSignals, signalId);
+    }
+
+    void WriteFast(const IoSignalHandle signalHandle, const uint32_t length, const void* value) const override {
+        for (const Session& session : _sessions) {
+            session.ioBuffer->WriteFast(signalHandle, length, value);
         }
+    }
+
+    void ReadFast(const IoSignalHandle signalHandle, uint32_t& length, const void** value) const override {
+        if (_sessions.empty()) {
+            return;
+        }
+
+        _sessions.front().ioBuffer->ReadFast(signalHandle, length, value);
+    }
 
-        return _busBuffer->Transmit(message);
+    [[nodiscard]] bool Transmit(const CanMessage& message) const override {
+        return TransmitToAllSessions(message);
+    }
+
+    [[nodiscard]] bool Transmit(const EthMessage& message) const override {
+        return TransmitToAllSessions(message);
     }
 
     [[nodiscard]] bool Transmit(const LinMessage& message) const override {
-        if (!_channel) {
-            return true;
-        }
+        return TransmitToAllSessions(message);
+    }
 
-        return _busBuffer->Transmit(message);
+    [[nodiscard]] uint32_t TransmitMany(const CanMessage* messages, const uint32_t count) const override {
+        return TransmitManyToAllSessions(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const EthMessage* messages, const uint32_t count) const override {
+        return TransmitManyToAllSessions(messages, count);
+    }
+
+    [[nodiscard]] uint32_t TransmitMany(const LinMessage* messages, const uint32_t count) const override {
+        return TransmitManyToAllSessions(messages, count);
     }
 
     void BackgroundService() override {
-        if (!_channel) {
-            if (AcceptChannel()) {
-                if (!OnHandleConnect()) {
-                    CloseConnection();
-                    return;
-                }
+        std::unique_ptr<Channel> channel;
+        ConnectionKind connectionKind{};
+        if (AcceptChannel(channel, connectionKind)) {
+            if (!AddSession(std::move(channel), connectionKind)) {
+                return;
             }
-
-            return;
         }
 
-        Command command{};
-        if (!Ping(command)) {
-            CloseConnection();
-            return;
+        // A client with a pending step is still busy, so it is not pinged and the pipeline is kept filled
+        std::vector<Command> commands;
+        RunOnAllSessions(
+            [&](const Session& session) {
+                if (session.hasPendingStep) {
+                    return true;
+                }
+
+                LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
+                CheckResultWithMessage(Protocol::SendPing(session.channel->GetWriter()), "Could not send ping frame.");
+                _latencyRecorder.Record(Command::Ping, LatencyPhase::Send, time);
+                return true;
+            },
+            [&](const Session& session) {
+                if (session.hasPendingStep) {
+                    return true;
+                }
+
+                Command command{};
+                CheckResultWithMessage(WaitForPingOkFrame(session, command), "Could not receive ping ok frame.");
+                commands.push_back(command);
+                return true;
+            });
+
+        HandlePendingCommands(Command::Ping, commands);
+    }
+
+    [[nodiscard]] uint32_t GetClientCount() const override {
+        return static_cast<uint32_t>(_sessions.size());
+    }
+
+    [[nodiscard]] std::vector<uint32_t> GetClientIds() const override {
+        std::vector<uint32_t> clientIds;
+        clientIds.reserve(_sessions.size());
+        for (const Session& session : _sessions) {
+            clientIds.push_back(session.clientId);
         }
 
-        HandlePendingCommand(command);
+        return clientIds;
     }
 
     [[nodiscard]] uint16_t GetLocalPort() const override {
@@ -227,54 +389,227 @@ public:
         return 0;
     }
 
+    [[nodiscard]] LatencyStatistics GetLatencyStatistics(const Command command,
+                                                         const LatencyPhase phase) const override {
+        return _latencyRecorder.GetStatistics(command, phase);
+    }
+
+    void ResetLatencyStatistics() override {
+        _latencyRecorder.Reset();
+    }
+
 private:
-    [[nodiscard]] bool StartInternal(const SimulationTime simulationTime) const {
-        CheckResultWithMessage(Protocol::SendStart(_channel->GetWriter(), simulationTime),
-                               "Could not send start frame.");
-        CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
-        return true;
+    struct Session {
+        // Sessions are removed when their client disconnects, so a client is identified by its id, not its position
+        uint32_t clientId{};
+        std::unique_ptr<Channel> channel;
+        ConnectionKind connectionKind = ConnectionKind::Remote;
+        std::string bufferName;
+        std::unique_ptr<IoBuffer> ioBuffer;
+        std::unique_ptr<BusBuffer> busBuffer;
+        bool isPipelined{};
+        bool supportsStepN{};
+        bool hasPendingStep{};
+        bool isFaulted{};
+        // The step ok frame encodes its bus timestamps relative to the last sent step or step n frame
+        SimulationTime stepSimulationTime{};
+    };
+
+    // All frames are sent before any response is awaited, so the clients work on them in parallel
+    template <typename TSend, typename TReceive>
+    void RunOnAllSessions(TSend send, TReceive receive) {
+        // Every response to a sent frame is consumed before an error is rethrown, so no channel gets out of sync. A
+        // session that failed is closed, since its channel state is unknown
+        std::exception_ptr exception;
+        for (Session& session : _sessions) {
+            try {
+                session.isFaulted = !send(session);
+            } catch (...) {
+                session.isFaulted = true;
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        for (Session& session : _sessions) {
+            if (session.isFaulted) {
+                continue;
+            }
+
+            try {
+                session.isFaulted = !receive(session);
+            } catch (...) {
+                session.isFaulted = true;
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        // The clients work in parallel, so the waits of all sessions together make up one sample
+        if (_hasWaited) {
+            _hasWaited = false;
+            _latencyRecorder.Record(_waitCommand, LatencyPhase::Wait, _waitTime);
+            _waitTime = {};
+        }
+
+        CloseFaultedConnections();
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
     }
 
-    [[nodiscard]] bool StopInternal(const SimulationTime simulationTime) const {
-        CheckResultWithMessage(Protocol::SendStop(_channel->GetWriter(), simulationTime), "Could not send stop frame.");
-        CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
-        return true;
+    // Sends a frame, which the clients acknowledge with an ok frame
+    template <typename TSend>
+    void RunCommandOnAllSessions(const Command command, TSend send) {
+        RunOnAllSessions(
+            [&](Session& session) {
+                LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
+                CheckResult(send(session));
+                _latencyRecorder.Record(command, LatencyPhase::Send, time);
+                return true;
+            },
+            [&](const Session& session) {
+                CheckResultWithMessage(WaitForOkFrame(session, command), "Could not receive ok frame.");
+                return true;
+            });
     }
 
-    [[nodiscard]] bool TerminateInternal(const SimulationTime simulationTime, const TerminateReason reason) const {
-        CheckResultWithMessage(Protocol::SendTerminate(_channel->GetWriter(), simulationTime, reason),
-                               "Could not send terminate frame.");
-        CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+    [[nodiscard]] bool ReceiveStepOk(const Session& session,
+                                     SimulationTime& nextSimulationTime,
+                                     std::vector<Command>& commands) {
+        SimulationTime clientNextSimulationTime{};
+        Command command{};
+        CheckResultWithMessage(WaitForStepOkFrame(session, clientNextSimulationTime, command),
+                               "Could not receive step ok frame");
+
+        // The earliest requested simulation time wins
+        if ((clientNextSimulationTime > SimulationTime{}) &&
+            ((nextSimulationTime == SimulationTime{}) || (clientNextSimulationTime < nextSimulationTime))) {
+            nextSimulationTime = clientNextSimulationTime;
+        }
+
+        commands.push_back(command);
         return true;
     }
 
-    [[nodiscard]] bool PauseInternal(const SimulationTime simulationTime) const {
-        CheckResultWithMessage(Protocol::SendPause(_channel->GetWriter(), simulationTime),
-                               "Could not send pause frame.");
-        CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+    [[nodiscard]] bool SendStep(Session& session, const SimulationTime simulationTime) {
+        session.stepSimulationTime = simulationTime;
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
+        ChannelWriter& writer = session.channel->GetWriter();
+        CheckResult(Protocol::WriteStep(writer, simulationTime, *session.ioBuffer, *session.busBuffer));
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Serialize, time);
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Send, time);
         return true;
     }
 
-    [[nodiscard]] bool ContinueInternal(const SimulationTime simulationTime) const {
-        CheckResultWithMessage(Protocol::SendContinue(_channel->GetWriter(), simulationTime),
-                               "Could not send continue frame.");
-        CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+    [[nodiscard]] bool SendStepN(Session& session, const SimulationTime simulationTime, const uint32_t stepCount) {
+        session.stepSimulationTime = simulationTime;
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
+        ChannelWriter& writer = session.channel->GetWriter();
+        CheckResult(Protocol::WriteStepN(writer, simulationTime, stepCount, *session.ioBuffer, *session.busBuffer));
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Serialize, time);
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+        _latencyRecorder.Record(Command::Step, LatencyPhase::Send, time);
         return true;
     }
 
-    [[nodiscard]] bool StepInternal(const SimulationTime simulationTime,
-                                    SimulationTime& nextSimulationTime,
-                                    Command& command) const {
-        CheckResultWithMessage(Protocol::SendStep(_channel->GetWriter(), simulationTime, *_ioBuffer, *_busBuffer),
-                               "Could not send step frame.");
-        CheckResultWithMessage(WaitForStepOkFrame(nextSimulationTime, command), "Could not receive step ok frame");
+    // Consumes the responses to pipelined steps, since every other frame expects a client waiting for a new frame
+    void FinishPendingSteps() {
+        std::vector<Command> commands;
+        RunOnAllSessions([](const Session&) { return true; },
+                         [&](Session& session) {
+                             if (!session.hasPendingStep) {
+                                 return true;
+                             }
+
+                             session.hasPendingStep = false;
+                             SimulationTime nextSimulationTime{};
+                             Command command{};
+                             CheckResultWithMessage(WaitForStepOkFrame(session, nextSimulationTime, command),
+                                                    "Could not receive step ok frame");
+                             commands.push_back(command);
+                             return true;
+                         });
+
+        HandlePendingCommands(Command::Step, commands);
+    }
+
+    template <typename TMessage>
+    [[nodiscard]] bool TransmitToAllSessions(const TMessage& message) const {
+        bool result = true;
+        for (const Session& session : _sessions) {
+            result = session.busBuffer->Transmit(message) && result;
+        }
+
+        return result;
+    }
+
+    template <typename TMessage>
+    [[nodiscard]] uint32_t TransmitManyToAllSessions(const TMessage* messages, const uint32_t count) const {
+        uint32_t transmittedCount = count;
+        for (const Session& session : _sessions) {
+            transmittedCount = std::min(session.busBuffer->TransmitMany(messages, count), transmittedCount);
+        }
+
+        return transmittedCount;
+    }
+
+    [[nodiscard]] bool IsFull() const {
+        return _sessions.size() >= _maxClientCount;
+    }
+
+    [[nodiscard]] bool AddSession(std::unique_ptr<Channel> channel, const ConnectionKind connectionKind) {
+        Session session{};
+        session.channel = std::move(channel);
+        session.channel->SetWaitMode(_waitMode, _spinTime);
+        session.connectionKind = connectionKind;
+
+        bool isRejected{};
+        if (!OnHandleConnect(session, isRejected)) {
+            OnConnectionClosed();
+            return false;
+        }
+
+        if (isRejected) {
+            return false;
+        }
+
+        session.clientId = _nextClientId++;
+        _sessions.push_back(std::move(session));
+        if (IsFull()) {
+            StopAccepting();
+        }
+
         return true;
     }
 
-    void CloseConnection() {
-        LogWarning("dSPACE VEOS CoSim client disconnected.");
+    [[nodiscard]] const Session& FindSession(const uint32_t clientId) const {
+        for (const Session& session : _sessions) {
+            if (session.clientId == clientId) {
+                return session;
+            }
+        }
+
+        throw CoSimException("Client " + std::to_string(clientId) + " is not connected.");
+    }
+
+    void CloseFaultedConnections() {
+        for (auto it = _sessions.begin(); it != _sessions.end();) {
+            if (it->isFaulted) {
+                it = _sessions.erase(it);
+                OnConnectionClosed();
+            } else {
+                ++it;
+            }
+        }
+    }
 
-        _channel.reset();
+    void OnConnectionClosed() {
+        LogWarning("dSPACE VEOS CoSim client disconnected.");
 
         if (!_isClientOptional && _callbacks.simulationStoppedCallback) {
             _callbacks.simulationStoppedCallback(milliseconds(0));
@@ -283,25 +618,15 @@ private:
         StartAccepting();
     }
 
-    [[nodiscard]] bool Ping(Command& command) const {
-        CheckResultWithMessage(Protocol::SendPing(_channel->GetWriter()), "Could not send ping frame.");
-        CheckResultWithMessage(WaitForPingOkFrame(command), "Could not receive ping ok frame.");
-        return true;
-    }
-
     void StartAccepting() {
         uint16_t port{};
         if (!_tcpChannelServer) {
-            _tcpChannelServer = CreateTcpChannelServer(_localPort, _enableRemoteAccess);
+            _tcpChannelServer = CreateTcpChannelServer(_localPort, _enableRemoteAccess, _tcpSocketOptions);
             port = _tcpChannelServer->GetLocalPort();
         }
 
         if (!_localChannelServer) {
-#ifdef _WIN32
             _localChannelServer = CreateLocalChannelServer(_serverName);
-#else
-            _localChannelServer = CreateUdsChannelServer(_serverName);
-#endif
         }
 
         if (port != 0) {
@@ -332,28 +657,23 @@ private:
             _tcpChannelServer.reset();
         }
 
-        if (_localChannelServer) {
-            _localChannelServer.reset();
-        }
+        // The local channel server stays alive, since recreating it would reset its channel counter and clients
+        // connecting while the server is full are rejected explicitly
     }
 
-    [[nodiscard]] bool AcceptChannel() {
-        if (_channel) {
-            return true;
-        }
-
+    [[nodiscard]] bool AcceptChannel(std::unique_ptr<Channel>& channel, ConnectionKind& connectionKind) const {
         if (_localChannelServer) {
-            _channel = _localChannelServer->TryAccept();
-            if (_channel) {
-                _connectionKind = ConnectionKind::Local;
+            channel = _localChannelServer->TryAccept();
+            if (channel) {
+                connectionKind = ConnectionKind::Local;
                 return true;
             }
         }
 
         if (_tcpChannelServer) {
-            _channel = _tcpChannelServer->TryAccept();
-            if (_channel) {
-                _connectionKind = ConnectionKind::Remote;
+            channel = _tcpChannelServer->TryAccept();
+            if (channel) {
+                connectionKind = ConnectionKind::Remote;
                 return true;
             }
         }
@@ -361,15 +681,60 @@ private:
         return false;
     }
 
-    [[nodiscard]] bool OnHandleConnect() {
+    [[nodiscard]] bool OnHandleConnect(Session& session, bool& isRejected) {
         uint32_t clientProtocolVersion{};
+        Mode clientMode{};
         std::string clientName;
-        CheckResultWithMessage(WaitForConnectFrame(clientProtocolVersion, clientName),
+        CheckResultWithMessage(WaitForConnectFrame(session, clientProtocolVersion, clientMode, clientName),
                                "Could not receive connect frame.");
 
-        CheckResultWithMessage(Protocol::SendConnectOk(_channel->GetWriter(),
-                                                       CoSimProtocolVersion,
-                                                       {},
+        const uint32_t protocolVersion = NegotiateProtocolVersion(clientProtocolVersion);
+
+        // Local clients before protocol version 1.2 share the buffers named after the server
+        session.bufferName = _serverName;
+        if ((session.connectionKind == ConnectionKind::Local) && (protocolVersion >= CoSimProtocolVersion1_2)) {
+            session.bufferName = session.channel->GetName();
+        }
+
+        std::string rejectReason;
+        if (IsFull()) {
+            rejectReason = "dSPACE VEOS CoSim server '" + _serverName + "' does not accept more than " +
+                           std::to_string(_maxClientCount) + " client(s).";
+        } else if ((session.connectionKind == ConnectionKind::Local) && (session.bufferName == _serverName) &&
+                   IsLocalLegacyClientConnected()) {
+            rejectReason = "dSPACE VEOS CoSim server '" + _serverName +
+                           "' does not accept more than one local client with a protocol version before 1.2.";
+        }
+
+        if (!rejectReason.empty()) {
+            LogWarning(rejectReason);
+            CheckResultWithMessage(Protocol::SendError(session.channel->GetWriter(), rejectReason),
+                                   "Could not send error frame.");
+            isRejected = true;
+            return true;
+        }
+
+        session.isPipelined = _enablePipelinedSteps && HasFlag(clientMode, Mode::PipelinedSteps);
+        session.supportsStepN = HasFlag(clientMode, Mode::StepN);
+        const bool isCompressed = _enableCompression && (session.connectionKind == ConnectionKind::Remote) &&
+                                  HasFlag(clientMode, Mode::Compression);
+
+        Mode mode{};
+        if (session.isPipelined) {
+            mode |= Mode::PipelinedSteps;
+        }
+
+        if (session.supportsStepN) {
+            mode |= Mode::StepN;
+        }
+
+        if (isCompressed) {
+            mode |= Mode::Compression;
+        }
+
+        CheckResultWithMessage(Protocol::SendConnectOk(session.channel->GetWriter(),
+                                                       protocolVersion,
+                                                       mode,
                                                        _stepSize,
                                                        {},
                                                        _incomingSignals,
@@ -379,28 +744,36 @@ private:
                                                        _linControllers),
                                "Could not send connect ok frame.");
 
+        if (protocolVersion >= CoSimProtocolVersion1_3) {
+            session.channel->EnableLargeFrames();
+        }
+
+        if (isCompressed) {
+            session.channel->EnableCompression();
+        }
+
         const std::vector<IoSignal> incomingSignalsExtern = Convert(_incomingSignals);
         const std::vector<IoSignal> outgoingSignalsExtern = Convert(_outgoingSignals);
-        _ioBuffer = CreateIoBuffer(CoSimType::Server,
-                                   _connectionKind,
-                                   _serverName,
-                                   incomingSignalsExtern,
-                                   outgoingSignalsExtern);
+        session.ioBuffer = CreateIoBuffer(CoSimType::Server,
+                                          session.connectionKind,
+                                          protocolVersion,
+                                          session.bufferName,
+                                          incomingSignalsExtern,
+                                          outgoingSignalsExtern);
 
         const std::vector<CanController> canControllersExtern = Convert(_canControllers);
         const std::vector<EthController> ethControllersExtern = Convert(_ethControllers);
         const std::vector<LinController> linControllersExtern = Convert(_linControllers);
-        _busBuffer = CreateBusBuffer(CoSimType::Server,
-                                     _connectionKind,
-                                     _serverName,
-                                     canControllersExtern,
-                                     ethControllersExtern,
-                                     linControllersExtern);
-
-        StopAccepting();
-
-        if (_connectionKind == ConnectionKind::Remote) {
-            const std::string remoteAddress = _channel->GetRemoteAddress();
+        session.busBuffer = CreateBusBuffer(CoSimType::Server,
+                                            session.connectionKind,
+                                            protocolVersion,
+                                            session.bufferName,
+                                            canControllersExtern,
+                                            ethControllersExtern,
+                                            linControllersExtern);
+
+        if (session.connectionKind == ConnectionKind::Remote) {
+            const std::string remoteAddress = session.channel->GetRemoteAddress();
             if (clientName.empty()) {
                 LogInfo("dSPACE VEOS CoSim client at " + remoteAddress + " connected.");
             } else {
@@ -417,16 +790,37 @@ private:
         return true;
     }
 
-    [[nodiscard]] bool WaitForOkFrame() const {
+    [[nodiscard]] bool IsLocalLegacyClientConnected() const {
+        for (const Session& session : _sessions) {
+            if ((session.connectionKind == ConnectionKind::Local) && (session.bufferName == _serverName)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Restarts the measurement like LatencyRecorder::Record, so the deserialize phase can be chained
+    void AddWaitTime(const Command command, LatencyRecorder::Clock::time_point& start) {
+        const LatencyRecorder::Clock::time_point now = LatencyRecorder::Clock::now();
+        _waitTime += now - start;
+        _waitCommand = command;
+        _hasWaited = true;
+        start = now;
+    }
+
+    [[nodiscard]] bool WaitForOkFrame(const Session& session, const Command command) {
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
         FrameKind frameKind{};
-        CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+        CheckResult(Protocol::ReceiveHeader(session.channel->GetReader(), frameKind));
+        AddWaitTime(command, time);
 
         switch (frameKind) {
             case FrameKind::Ok:
                 return true;
             case FrameKind::Error: {
                 std::string errorMessage;
-                CheckResultWithMessage(Protocol::ReadError(_channel->GetReader(), errorMessage),
+                CheckResultWithMessage(Protocol::ReadError(session.channel->GetReader(), errorMessage),
                                        "Could not read error frame.");
                 throw CoSimException(errorMessage);
             }
@@ -435,30 +829,35 @@ private:
         }
     }
 
-    [[nodiscard]] bool WaitForPingOkFrame(Command& command) const {
+    [[nodiscard]] bool WaitForPingOkFrame(const Session& session, Command& command) {
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
         FrameKind frameKind{};
-        CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+        CheckResult(Protocol::ReceiveHeader(session.channel->GetReader(), frameKind));
+        AddWaitTime(Command::Ping, time);
 
         switch (frameKind) {
             case FrameKind::PingOk:
-                CheckResultWithMessage(Protocol::ReadPingOk(_channel->GetReader(), command),
+                CheckResultWithMessage(Protocol::ReadPingOk(session.channel->GetReader(), command),
                                        "Could not read ping ok frame.");
+                _latencyRecorder.Record(Command::Ping, LatencyPhase::Deserialize, time);
                 return true;
             default:
                 throw CoSimException("Received unexpected frame " + ToString(frameKind) + ".");
         }
     }
 
-    [[nodiscard]] bool WaitForConnectFrame(uint32_t& version, std::string& clientName) const {
+    [[nodiscard]] bool WaitForConnectFrame(const Session& session,
+                                           uint32_t& version,
+                                           Mode& mode,
+                                           std::string& clientName) const {
         FrameKind frameKind{};
-        CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+        CheckResult(Protocol::ReceiveHeader(session.channel->GetReader(), frameKind));
 
         switch (frameKind) {
             case FrameKind::Connect: {
-                Mode mode{};
                 std::string serverName;
                 CheckResultWithMessage(
-                    Protocol::ReadConnect(_channel->GetReader(), version, mode, serverName, clientName),
+                    Protocol::ReadConnect(session.channel->GetReader(), version, mode, serverName, clientName),
                     "Could not read connect frame.");
                 return true;
             }
@@ -467,23 +866,27 @@ private:
         }
     }
 
-    [[nodiscard]] bool WaitForStepOkFrame(SimulationTime& simulationTime, Command& command) const {
+    [[nodiscard]] bool WaitForStepOkFrame(const Session& session, SimulationTime& simulationTime, Command& command) {
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
         FrameKind frameKind{};
-        CheckResult(Protocol::ReceiveHeader(_channel->GetReader(), frameKind));
+        CheckResult(Protocol::ReceiveHeader(session.channel->GetReader(), frameKind));
+        AddWaitTime(Command::Step, time);
 
         switch (frameKind) {
             case FrameKind::StepOk:
-                CheckResultWithMessage(Protocol::ReadStepOk(_channel->GetReader(),
+                CheckResultWithMessage(Protocol::ReadStepOk(session.channel->GetReader(),
+                                                            session.stepSimulationTime,
                                                             simulationTime,
                                                             command,
-                                                            *_ioBuffer,
-                                                            *_busBuffer,
+                                                            *session.ioBuffer,
+                                                            *session.busBuffer,
                                                             _callbacks),
                                        "Could not receive step ok frame.");
+                _latencyRecorder.Record(Command::Step, LatencyPhase::Deserialize, time);
                 return true;
             case FrameKind::Error: {
                 std::string errorMessage;
-                CheckResultWithMessage(Protocol::ReadError(_channel->GetReader(), errorMessage),
+                CheckResultWithMessage(Protocol::ReadError(session.channel->GetReader(), errorMessage),
                                        "Could not read error frame.");
                 throw CoSimException(errorMessage);
             }
@@ -492,34 +895,55 @@ private:
         }
     }
 
-    void HandlePendingCommand(const Command command) const {
+    // Only round trips, on which a client requested a command, are recorded, since all others invoke no callback.
+    // Several clients requesting the same command on one round trip invoke its callback once
+    void HandlePendingCommands(const Command roundTripCommand, const std::vector<Command>& commands) {
+        LatencyRecorder::Clock::time_point time = LatencyRecorder::Clock::now();
+        bool hasInvokedCallback{};
+        for (auto it = commands.begin(); it != commands.end(); ++it) {
+            if (std::find(commands.begin(), it, *it) != it) {
+                continue;
+            }
+
+            hasInvokedCallback = HandlePendingCommand(*it) || hasInvokedCallback;
+        }
+
+        if (hasInvokedCallback) {
+            _latencyRecorder.Record(roundTripCommand, LatencyPhase::Callback, time);
+        }
+    }
+
+    [[nodiscard]] bool HandlePendingCommand(const Command command) const {
         switch (command) {
             case Command::Start:
                 _callbacks.simulationStartedCallback({});
-                break;
+                return true;
             case Command::Stop:
                 _callbacks.simulationStoppedCallback({});
-                break;
+                return true;
             case Command::Terminate:
                 _callbacks.simulationTerminatedCallback({}, TerminateReason::Error);
-                break;
+                return true;
             case Command::Pause:
                 _callbacks.simulationPausedCallback({});
-                break;
+                return true;
             case Command::Continue:
                 _callbacks.simulationContinuedCallback({});
-                break;
+                return true;
             case Command::TerminateFinished:
                 _callbacks.simulationTerminatedCallback({}, TerminateReason::Finished);
-                break;
+                return true;
             case Command::None:
             case Command::Step:
             case Command::Ping:
                 break;
         }
+
+        return false;
     }
 
-    std::unique_ptr<Channel> _channel;
+    std::vector<Session> _sessions;
+    uint32_t _nextClientId{};
 
     uint16_t _localPort{};
     bool _enableRemoteAccess{};
@@ -528,20 +952,27 @@ private:
     std::unique_ptr<ChannelServer> _tcpChannelServer;
     std::unique_ptr<ChannelServer> _localChannelServer;
 
-    ConnectionKind _connectionKind = ConnectionKind::Remote;
     std::string _serverName;
     Callbacks _callbacks{};
     bool _isClientOptional{};
+    uint32_t _maxClientCount{};
+    bool _enablePipelinedSteps{};
+    bool _enableCompression{};
+    WaitMode _waitMode{};
+    std::chrono::microseconds _spinTime{};
+    TcpSocketOptions _tcpSocketOptions{};
     SimulationTime _stepSize{};
     bool _registerAtPortMapper{};
+    LatencyRecorder _latencyRecorder;
+    std::chrono::nanoseconds _waitTime{};
+    Command _waitCommand{};
+    bool _hasWaited{};
 
     std::vector<IoSignalContainer> _incomingSignals;
     std::vector<IoSignalContainer> _outgoingSignals;
     std::vector<CanControllerContainer> _canControllers;
     std::vector<EthControllerContainer> _ethControllers;
     std::vector<LinControllerContainer> _linControllers;
-    std::unique_ptr<IoBuffer> _ioBuffer;
-    std::unique_ptr<BusBuffer> _busBuffer;
 };
 
 }  // namespace
@@ -45,6 +45,37 @@ namespace {
     throw std::runtime_error("Invalid data type.");
 }
 
+void CheckCanMessageMaxLength(const uint32_t length) {
+    if (length > CanMessageMaxLength) {
+        throw CoSimException("CAN message data exceeds maximum length.");
+    }
+}
+
+void CheckCanMessageFlags(const CanMessageFlags flags, const uint32_t length) {
+    if (!HasFlag(flags, CanMessageFlags::FlexibleDataRateFormat)) {
+        if (length > 8) {
+            throw CoSimException("CAN message flags invalid. A DLC > 8 requires the flexible data rate format flag.");
+        }
+
+        if (HasFlag(flags, CanMessageFlags::BitRateSwitch)) {
+            throw CoSimException(
+                "CAN message flags invalid. A bit rate switch flag requires the flexible data rate format flag.");
+        }
+    }
+}
+
+void CheckEthMessageMaxLength(const uint32_t length) {
+    if (length > EthMessageMaxLength) {
+        throw CoSimException("Ethernet message data exceeds maximum length.");
+    }
+}
+
+void CheckLinMessageMaxLength(const uint32_t length) {
+    if (length > LinMessageMaxLength) {
+        throw CoSimException("LIN message data exceeds maximum length.");
+    }
+}
+
 }  // namespace
 
 [[nodiscard]] std::string DataToString(const uint8_t* data, const size_t dataLength, const char separator) {
@@ -277,8 +308,64 @@ namespace {
     return "<Unknown SimulationState>";
 }
 
-[[nodiscard]] std::string ToString([[maybe_unused]] const Mode mode) {
-    return "<Unused>";
+[[nodiscard]] std::string ToString(const Mode mode) {
+    std::string modeStr;
+
+    if (HasFlag(mode, Mode::PipelinedSteps)) {
+        modeStr += ",PipelinedSteps";
+    }
+
+    if (HasFlag(mode, Mode::StepN)) {
+        modeStr += ",StepN";
+    }
+
+    if (HasFlag(mode, Mode::Compression)) {
+        modeStr += ",Compression";
+    }
+
+    if (!modeStr.empty()) {
+        modeStr.erase(0, 1);
+    }
+
+    return modeStr;
+}
+
+[[nodiscard]] std::string ToString(const WaitMode waitMode) {
+    switch (waitMode) {
+        case WaitMode::Block:
+            return "Block";
+        case WaitMode::SpinThenBlock:
+            return "SpinThenBlock";
+    }
+
+    return "<Unknown WaitMode>";
+}
+
+[[nodiscard]] std::string ToString(const LatencyPhase latencyPhase) {
+    switch (latencyPhase) {
+        case LatencyPhase::Serialize:
+            return "Serialize";
+        case LatencyPhase::Send:
+            return "Send";
+        case LatencyPhase::Wait:
+            return "Wait";
+        case LatencyPhase::Deserialize:
+            return "Deserialize";
+        case LatencyPhase::Callback:
+            return "Callback";
+    }
+
+    return "<Unknown LatencyPhase>";
+}
+
+[[nodiscard]] std::string ToString(const LatencyStatistics& statistics) {
+    return "Count: " + std::to_string(statistics.count) + ", Min: " + std::to_string(statistics.minimum.count()) +
+           " ns, Max: " + std::to_string(statistics.maximum.count()) +
+           " ns, Mean: " + std::to_string(statistics.mean.count()) +
+           " ns, P50: " + std::to_string(statistics.p50.count()) +
+           " ns, P90: " + std::to_string(statistics.p90.count()) +
+           " ns, P99: " + std::to_string(statistics.p99.count()) +
+           " ns, P99.9: " + std::to_string(statistics.p999.count()) + " ns";
 }
 
 [[nodiscard]] std::string ToString(const IoSignalId signalId) {
@@ -424,23 +511,20 @@ namespace {
     return message;
 }
 
+void CanMessage::CheckMaxLength() const {
+    CheckCanMessageMaxLength(length);
+}
+
+void CanMessage::CheckFlags() const {
+    CheckCanMessageFlags(flags, length);
+}
+
 void CanMessageContainer::CheckMaxLength() const {
-    if (length > CanMessageMaxLength) {
-        throw CoSimException("CAN message data exceeds maximum length.");
-    }
+    CheckCanMessageMaxLength(length);
 }
 
 void CanMessageContainer::CheckFlags() const {
-    if (!HasFlag(flags, CanMessageFlags::FlexibleDataRateFormat)) {
-        if (length > 8) {
-            throw CoSimException("CAN message flags invalid. A DLC > 8 requires the flexible data rate format flag.");
-        }
-
-        if (HasFlag(flags, CanMessageFlags::BitRateSwitch)) {
-            throw CoSimException(
-                "CAN message flags invalid. A bit rate switch flag requires the flexible data rate format flag.");
-        }
-    }
+    CheckCanMessageFlags(flags, length);
 }
 
 [[nodiscard]] std::string ToString(const CanMessage& message) {
@@ -559,10 +643,12 @@ void CanMessageContainer::CheckFlags() const {
     return message;
 }
 
+void EthMessage::CheckMaxLength() const {
+    CheckEthMessageMaxLength(length);
+}
+
 void EthMessageContainer::CheckMaxLength() const {
-    if (length > EthMessageMaxLength) {
-        throw CoSimException("Ethernet message data exceeds maximum length.");
-    }
+    CheckEthMessageMaxLength(length);
 }
 
 [[nodiscard]] std::string ToString(const EthMessage& message) {
@@ -728,10 +814,12 @@ void EthMessageContainer::CheckMaxLength() const {
     return message;
 }
 
+void LinMessage::CheckMaxLength() const {
+    CheckLinMessageMaxLength(length);
+}
+
 void LinMessageContainer::CheckMaxLength() const {
-    if (length > LinMessageMaxLength) {
-        throw CoSimException("LIN message data exceeds maximum length.");
-    }
+    CheckLinMessageMaxLength(length);
 }
 
 [[nodiscard]] std::string ToString(const LinMessage& message) {
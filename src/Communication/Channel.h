@@ -2,13 +2,20 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
 
+#include "DsVeosCoSim/CoSimTypes.h"
+
 namespace DsVeosCoSim {
 
+constexpr size_t MaxVarintSize = 10;
+
 class ChannelWriter {  // NOLINT
 public:
     virtual ~ChannelWriter() noexcept = default;
@@ -20,6 +27,23 @@ public:
         return Write(&value, sizeof(T));
     }
 
+    // Writes the value in groups of 7 bits, so small values only take a single byte
+    template <typename T>
+    [[nodiscard]] bool WriteVarint(const T value) {
+        static_assert(std::is_unsigned_v<T> || std::is_enum_v<T>);
+
+        std::array<uint8_t, MaxVarintSize> buffer{};
+        size_t size{};
+        auto rest = static_cast<uint64_t>(value);
+        while (rest >= 0x80U) {
+            buffer[size++] = static_cast<uint8_t>(rest | 0x80U);
+            rest >>= 7U;
+        }
+
+        buffer[size++] = static_cast<uint8_t>(rest);
+        return Write(buffer.data(), size);
+    }
+
     [[nodiscard]] virtual bool Write(const void* source, size_t size) = 0;
 
     [[nodiscard]] virtual bool EndWrite() = 0;
@@ -36,7 +60,37 @@ public:
         return Read(&value, sizeof(T));
     }
 
+    template <typename T>
+    [[nodiscard]] bool ReadVarint(T& value) {
+        static_assert(std::is_unsigned_v<T> || std::is_enum_v<T>);
+
+        uint64_t result{};
+        for (uint32_t shift = 0; shift < (MaxVarintSize * 7); shift += 7) {
+            uint8_t byte{};
+            if (!Read(byte)) {
+                return false;
+            }
+
+            result |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                if constexpr (sizeof(T) < sizeof(uint64_t)) {
+                    if ((result >> (sizeof(T) * 8)) != 0) {
+                        throw CoSimException("Protocol error. Varint exceeds the value range.");
+                    }
+                }
+
+                value = static_cast<T>(result);
+                return true;
+            }
+        }
+
+        throw CoSimException("Protocol error. Varint is too long.");
+    }
+
     [[nodiscard]] virtual bool Read(void* destination, size_t size) = 0;
+
+    // Reads size bytes without copying them where possible. The view is valid until the next call on the reader
+    [[nodiscard]] virtual bool ReadView(size_t size, const uint8_t*& data) = 0;
 };
 
 class Channel {  // NOLINT
@@ -45,8 +99,20 @@ public:
 
     [[nodiscard]] virtual std::string GetRemoteAddress() const = 0;
 
+    // Unique name of a local channel, empty for socket channels
+    [[nodiscard]] virtual std::string GetName() const = 0;
+
     virtual void Disconnect() = 0;
 
+    // Lets the writer send frames larger than 64 KB, which the counterpart must be able to read
+    virtual void EnableLargeFrames() = 0;
+
+    // Lets the writer compress large frames. Readers always accept compressed frames
+    virtual void EnableCompression() = 0;
+
+    // Lets the reader poll for incoming data before it blocks in the operating system
+    virtual void SetWaitMode(WaitMode waitMode, std::chrono::microseconds spinTime) = 0;
+
     [[nodiscard]] virtual ChannelWriter& GetWriter() = 0;
     [[nodiscard]] virtual ChannelReader& GetReader() = 0;
 };
@@ -66,13 +132,16 @@ public:
 [[nodiscard]] std::unique_ptr<Channel> TryConnectToTcpChannel(std::string_view remoteIpAddress,
                                                               uint16_t remotePort,
                                                               uint16_t localPort,
-                                                              uint32_t timeoutInMilliseconds);
+                                                              uint32_t timeoutInMilliseconds,
+                                                              const TcpSocketOptions& socketOptions = {});
 
 [[nodiscard]] std::unique_ptr<Channel> TryConnectToUdsChannel(const std::string& name);
 
 [[nodiscard]] std::unique_ptr<ChannelServer> CreateLocalChannelServer(const std::string& name);
 
-[[nodiscard]] std::unique_ptr<ChannelServer> CreateTcpChannelServer(uint16_t port, bool enableRemoteAccess);
+[[nodiscard]] std::unique_ptr<ChannelServer> CreateTcpChannelServer(uint16_t port,
+                                                                    bool enableRemoteAccess,
+                                                                    const TcpSocketOptions& socketOptions = {});
 
 [[nodiscard]] std::unique_ptr<ChannelServer> CreateUdsChannelServer(const std::string& name);
 
@@ -1,9 +1,8 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -11,14 +10,15 @@
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Channel.h"
 #include "CoSimHelper.h"
-#include "Handle.h"
 #include "NamedEvent.h"
 #include "NamedMutex.h"
 #include "OsUtilities.h"
 #include "SharedMemory.h"
+#include "SpinWait.h"
 
 namespace DsVeosCoSim {
 
@@ -76,13 +76,6 @@ protected:
         _header = static_cast<Header*>(_sharedMemory.data());
         _data = static_cast<uint8_t*>(_sharedMemory.data()) + sizeof(Header);
 
-        if (initShm) {
-            _header->serverPid = 0;
-            _header->clientPid = 0;
-            _header->writeIndex.store(0);
-            _header->readIndex.store(0);
-        }
-
         if (isServer) {
             _ownPid = &_header->serverPid;
             _counterpartPid = &_header->clientPid;
@@ -91,6 +84,20 @@ protected:
             _counterpartPid = &_header->serverPid;
         }
 
+#ifndef _WIN32
+        // POSIX shared memory survives crashed processes, so a leftover channel has to be reset
+        if (!initShm) {
+            initShm = (*_ownPid != 0) || IsLeftOver(*_counterpartPid);
+        }
+#endif
+
+        if (initShm) {
+            _header->serverPid = 0;
+            _header->clientPid = 0;
+            _header->writeIndex.store(0);
+            _header->readIndex.store(0);
+        }
+
         *_ownPid = GetCurrentProcessId();
     }
 
@@ -112,6 +119,12 @@ public:
     }
 
 protected:
+#ifndef _WIN32
+    [[nodiscard]] static bool IsLeftOver(const uint32_t processId) {
+        return (processId != 0) && !IsProcessRunning(processId);
+    }
+#endif
+
     [[nodiscard]] bool CheckIfConnectionIsAlive() {
         const uint32_t counterpartPid = *_counterpartPid;
         if (counterpartPid != 0) {
@@ -291,8 +304,26 @@ public:
         return true;
     }
 
+    void SetWaitMode(const WaitMode waitMode, const std::chrono::microseconds spinTime) {
+        _waitMode = waitMode;
+        _spinTime = spinTime;
+    }
+
+    [[nodiscard]] bool ReadView(const size_t size, const uint8_t*& data) override {
+        // The shared ring may be overwritten as soon as the read index is published, so views are always copied
+        _viewBuffer.resize(size);
+        CheckResult(Read(_viewBuffer.data(), size));
+        data = _viewBuffer.data();
+        return true;
+    }
+
 private:
     [[nodiscard]] bool BeginRead(uint32_t& currentSize) {
+        if (SpinWait(_waitMode, _spinTime, [this] { return _header->writeIndex.load() != _readIndex; })) {
+            currentSize = _header->writeIndex.load() - _readIndex;
+            return true;
+        }
+
         while (!_newDataEvent.Wait(1)) {
             currentSize = _header->writeIndex.load() - _readIndex;
             if (currentSize > 0) {
@@ -308,13 +339,17 @@ private:
         return true;
     }
 
+    WaitMode _waitMode{};
+    std::chrono::microseconds _spinTime{};
     uint32_t _readIndex{};
     uint32_t _maskedReadIndex{};
+    std::vector<uint8_t> _viewBuffer;
 };
 
 class LocalChannel final : public Channel {
 public:
-    LocalChannel(const std::string& name, const bool isServer) : _writer(name, isServer), _reader(name, isServer) {
+    LocalChannel(const std::string& name, const bool isServer)
+        : _name(name), _writer(name, isServer), _reader(name, isServer) {
     }
 
     ~LocalChannel() noexcept override = default;
@@ -329,11 +364,27 @@ public:
         return {};
     }
 
+    [[nodiscard]] std::string GetName() const override {
+        return _name;
+    }
+
     void Disconnect() override {
         _writer.Disconnect();
         _reader.Disconnect();
     }
 
+    void EnableLargeFrames() override {
+        // The shared memory stream has no frames
+    }
+
+    void EnableCompression() override {
+        // Copying through shared memory is cheaper than compressing
+    }
+
+    void SetWaitMode(const WaitMode waitMode, const std::chrono::microseconds spinTime) override {
+        _reader.SetWaitMode(waitMode, spinTime);
+    }
+
     [[nodiscard]] ChannelWriter& GetWriter() override {
         return _writer;
     }
@@ -343,6 +394,7 @@ public:
     }
 
 private:
+    std::string _name;
     LocalChannelWriter _writer;
     LocalChannelReader _reader;
 };
@@ -418,5 +470,3 @@ private:
 }
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -14,11 +14,15 @@
 
 #include "Channel.h"
 #include "CoSimHelper.h"
+#include "Compression.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "Socket.h"
+#include "SpinWait.h"
 
 #ifdef _WIN32
 #include <windows.h>  // NOLINT
+#else
+#include "IoUring.h"
 #endif
 
 namespace DsVeosCoSim {
@@ -27,7 +31,17 @@ namespace {
 
 constexpr int32_t HeaderSize = 4;
 constexpr int32_t BufferSize = 64 * 1024;
-constexpr int32_t ReadPacketSize = 1024;
+constexpr size_t DirectSendSize = 8 * 1024;
+constexpr size_t DirectReceiveSize = 8 * 1024;
+constexpr size_t MaxChunkSize = 1024 * 1024 * 1024;
+
+// Readers before protocol version 1.3 only accept frames of up to BufferSize bytes
+constexpr int32_t LargeFrameSize = HeaderSize + static_cast<int32_t>(MaxChunkSize);
+
+// Set in the header of a compressed frame, whose payload starts with the decompressed size
+constexpr uint32_t CompressedFrameFlag = 0x80000000U;
+constexpr int32_t CompressedSizeFieldSize = 4;
+constexpr int32_t CompressionThreshold = 4 * 1024;
 
 class SocketChannelWriter final : public ChannelWriter {
 public:
@@ -46,8 +60,26 @@ public:
     [[nodiscard]] bool Write(const void* source, size_t size) override {
         const auto* bufferPointer = static_cast<const uint8_t*>(source);
 
+        if (_isCompressionEnabled) {
+            // The whole frame is collected in the write buffer, so it can be compressed in one piece
+            const size_t requiredSize = static_cast<size_t>(_writeIndex) + size;
+            if (requiredSize > _writeBuffer.size()) {
+                _writeBuffer.resize(std::min(requiredSize, static_cast<size_t>(_maxFrameSize)));
+            }
+        } else if (size >= DirectSendSize) {
+            // Large payloads fill up frames directly from the source instead of being copied into the write buffer
+            while (size >= static_cast<size_t>(BufferSize - _writeIndex)) {
+                const int32_t sizeToSend =
+                    static_cast<int32_t>(std::min(size, static_cast<size_t>(_maxFrameSize - _writeIndex)));
+                CheckResult(SendFrame(bufferPointer, sizeToSend));
+                bufferPointer += sizeToSend;
+                size -= sizeToSend;
+            }
+        }
+
         while (size > 0) {
-            const int32_t sizeToCopy = std::min(static_cast<int32_t>(size), BufferSize - _writeIndex);
+            const int32_t sizeToCopy = static_cast<int32_t>(
+                std::min(size, _writeBuffer.size() - static_cast<size_t>(_writeIndex)));
             if (sizeToCopy == 0) {
                 CheckResult(EndWrite());
                 continue;
@@ -63,33 +95,103 @@ public:
     }
 
     [[nodiscard]] bool EndWrite() override {
+        return SendFrame(nullptr, 0);
+    }
+
+    void EnableLargeFrames() {
+        _maxFrameSize = LargeFrameSize;
+    }
+
+    void EnableCompression() {
+        _isCompressionEnabled = true;
+    }
+
+private:
+    // Sends the write buffer followed by the given payload as one frame
+    [[nodiscard]] bool SendFrame(const uint8_t* payload, int32_t payloadSize) {
+        if (_isCompressionEnabled && ((_writeIndex - HeaderSize) >= CompressionThreshold) && TryCompress()) {
+            return SendCompressedFrame();
+        }
+
         uint8_t* sourcePtr = _writeBuffer.data();
 
         // Write header
-        (void)memcpy(sourcePtr, &_writeIndex, sizeof _writeIndex);
+        const int32_t frameSize = _writeIndex + payloadSize;
+        (void)memcpy(sourcePtr, &frameSize, sizeof frameSize);
 
         while (_writeIndex > 0) {
             int32_t sentSize{};
-            CheckResult(_socket->Send(sourcePtr, _writeIndex, sentSize));
+            if (payloadSize > 0) {
+                CheckResult(_socket->Send(sourcePtr, _writeIndex, payload, payloadSize, sentSize));
+            } else {
+                CheckResult(_socket->Send(sourcePtr, _writeIndex, sentSize));
+            }
+
+            const int32_t sentBufferSize = std::min(sentSize, _writeIndex);
+            sourcePtr += sentBufferSize;
+            _writeIndex -= sentBufferSize;
+            payload += sentSize - sentBufferSize;
+            payloadSize -= sentSize - sentBufferSize;
+        }
+
+        while (payloadSize > 0) {
+            int32_t sentSize{};
+            CheckResult(_socket->Send(payload, payloadSize, sentSize));
+
+            payload += sentSize;
+            payloadSize -= sentSize;
+        }
 
+        _writeIndex = HeaderSize;
+        return true;
+    }
+
+    // Returns false if the data does not get smaller, so it is sent uncompressed
+    [[nodiscard]] bool TryCompress() {
+        const int32_t dataSize = _writeIndex - HeaderSize;
+        constexpr int32_t compressedDataOffset = HeaderSize + CompressedSizeFieldSize;
+        _compressedBuffer.resize(compressedDataOffset + GetMaxCompressedSize(dataSize));
+
+        const size_t compressedSize =
+            Compress(&_writeBuffer[HeaderSize], dataSize, &_compressedBuffer[compressedDataOffset]);
+        if (compressedSize + CompressedSizeFieldSize >= static_cast<size_t>(dataSize)) {
+            return false;
+        }
+
+        _compressedFrameSize = static_cast<int32_t>(compressedDataOffset + compressedSize);
+        const uint32_t header = static_cast<uint32_t>(_compressedFrameSize) | CompressedFrameFlag;
+        (void)memcpy(_compressedBuffer.data(), &header, sizeof header);
+        (void)memcpy(&_compressedBuffer[HeaderSize], &dataSize, sizeof dataSize);
+        return true;
+    }
+
+    [[nodiscard]] bool SendCompressedFrame() {
+        const uint8_t* sourcePtr = _compressedBuffer.data();
+        int32_t sizeToSend = _compressedFrameSize;
+        while (sizeToSend > 0) {
+            int32_t sentSize{};
+            CheckResult(_socket->Send(sourcePtr, sizeToSend, sentSize));
             sourcePtr += sentSize;
-            _writeIndex -= sentSize;
+            sizeToSend -= sentSize;
         }
 
         _writeIndex = HeaderSize;
         return true;
     }
 
-private:
     Socket* _socket{};
 
     int32_t _writeIndex{};
+    int32_t _maxFrameSize = BufferSize;
+    bool _isCompressionEnabled{};
+    int32_t _compressedFrameSize{};
     std::vector<uint8_t> _writeBuffer;
+    std::vector<uint8_t> _compressedBuffer;
 };
 
 class SocketChannelReader final : public ChannelReader {
 public:
-    explicit SocketChannelReader(Socket* socket) : _socket(socket), _readIndex(HeaderSize) {
+    explicit SocketChannelReader(Socket* socket) : _socket(socket) {
         _readBuffer.resize(BufferSize);
     }
 
@@ -105,78 +207,183 @@ public:
         auto* bufferPointer = static_cast<uint8_t*>(destination);
 
         while (size > 0) {
-            const int32_t sizeToCopy = std::min(static_cast<int32_t>(size), _endFrameIndex - _readIndex);
-            if (sizeToCopy <= 0) {
+            if (_remainingFrameSize == 0) {
                 CheckResult(BeginRead());
                 continue;
             }
 
-            (void)memcpy(bufferPointer, &_readBuffer[_readIndex], sizeToCopy);
-            _readIndex += sizeToCopy;
-            bufferPointer += sizeToCopy;
-            size -= sizeToCopy;
+            const int32_t bufferedSize = std::min(_writeIndex - _readIndex, _remainingFrameSize);
+            if (bufferedSize > 0) {
+                const int32_t sizeToCopy = std::min(static_cast<int32_t>(std::min(size, MaxChunkSize)), bufferedSize);
+                (void)memcpy(bufferPointer, &_readBuffer[_readIndex], sizeToCopy);
+                _readIndex += sizeToCopy;
+                _remainingFrameSize -= sizeToCopy;
+                bufferPointer += sizeToCopy;
+                size -= sizeToCopy;
+                continue;
+            }
+
+            // The read buffer is empty here, so large payloads are received directly into the destination
+            if (size >= DirectReceiveSize) {
+                const int32_t sizeToReceive =
+                    std::min(static_cast<int32_t>(std::min(size, MaxChunkSize)), _remainingFrameSize);
+                int32_t receivedSize{};
+                CheckResult(Receive(bufferPointer, sizeToReceive, receivedSize));
+                _remainingFrameSize -= receivedSize;
+                bufferPointer += receivedSize;
+                size -= receivedSize;
+                continue;
+            }
+
+            _readIndex = 0;
+            _writeIndex = 0;
+            CheckResult(ReceiveIntoBuffer());
         }
 
         return true;
     }
 
-private:
-    [[nodiscard]] bool BeginRead() {
-        _readIndex = HeaderSize;
-        int32_t sizeToRead = ReadPacketSize;
-        bool readHeader = true;
+    void SetWaitMode(const WaitMode waitMode, const std::chrono::microseconds spinTime) {
+        _waitMode = waitMode;
+        _spinTime = spinTime;
 
-        // Did we read more than one frame the last time?
-        if (_writeIndex > _endFrameIndex) {
-            const int32_t bytesToMove = _writeIndex - _endFrameIndex;
-            (void)memcpy(_readBuffer.data(), &_readBuffer[_endFrameIndex], bytesToMove);
+#ifndef _WIN32
+        // Spinning on the io_uring completion needs no system calls, in contrast to polling the socket
+        if ((_waitMode == WaitMode::SpinThenBlock) && !_ioUring) {
+            _ioUring = IoUring::TryCreate();
+        }
+#endif
+    }
 
-            _writeIndex -= _endFrameIndex;
+    [[nodiscard]] bool ReadView(const size_t size, const uint8_t*& data) override {
+        if (_remainingFrameSize == 0) {
+            CheckResult(BeginRead());
+        }
 
-            // Did we read at least HeaderSize bytes more?
-            if (bytesToMove >= HeaderSize) {
-                readHeader = false;
-                (void)memcpy(&_endFrameIndex, _readBuffer.data(), HeaderSize);
+        const auto viewSize = static_cast<int32_t>(std::min(size, static_cast<size_t>(BufferSize)));
+        if ((static_cast<size_t>(viewSize) != size) || (viewSize > _remainingFrameSize)) {
+            // Views crossing a frame boundary are copied
+            _viewBuffer.resize(size);
+            CheckResult(Read(_viewBuffer.data(), size));
+            data = _viewBuffer.data();
+            return true;
+        }
 
-                // Did we read at least an entire second frame?
-                if (_writeIndex >= _endFrameIndex) {
-                    return true;
-                }
+        if ((_writeIndex - _readIndex) < viewSize) {
+            // Move the buffered rest to the front, so the view fits into the read buffer
+            const int32_t bytesToMove = _writeIndex - _readIndex;
+            (void)memmove(_readBuffer.data(), &_readBuffer[_readIndex], bytesToMove);
+            _readIndex = 0;
+            _writeIndex = bytesToMove;
 
-                sizeToRead = _endFrameIndex - _writeIndex;
+            while (_writeIndex < viewSize) {
+                CheckResult(ReceiveIntoBuffer());
+            }
+        }
+
+        data = &_readBuffer[_readIndex];
+        _readIndex += viewSize;
+        _remainingFrameSize -= viewSize;
+        return true;
+    }
+
+private:
+    [[nodiscard]] bool BeginRead() {
+        // Move a partially received header to the front
+        if ((_writeIndex - _readIndex) < HeaderSize) {
+            const int32_t bytesToMove = _writeIndex - _readIndex;
+            (void)memmove(_readBuffer.data(), &_readBuffer[_readIndex], bytesToMove);
+            _readIndex = 0;
+            _writeIndex = bytesToMove;
+
+            while (_writeIndex < HeaderSize) {
+                CheckResult(ReceiveIntoBuffer());
             }
-        } else {
-            _writeIndex = 0;
         }
 
-        while (sizeToRead > 0) {
-            int32_t receivedSize{};
-            CheckResult(_socket->Receive(&_readBuffer[_writeIndex], sizeToRead, receivedSize));
+        uint32_t header{};
+        (void)memcpy(&header, &_readBuffer[_readIndex], HeaderSize);
+        const auto frameSize = static_cast<int32_t>(header & ~CompressedFrameFlag);
+        if ((frameSize < HeaderSize) || (frameSize > LargeFrameSize)) {
+            throw CoSimException("Protocol error. Invalid frame size.");
+        }
 
-            sizeToRead -= receivedSize;
-            _writeIndex += receivedSize;
+        _readIndex += HeaderSize;
+        _remainingFrameSize = frameSize - HeaderSize;
 
-            if (readHeader && (_writeIndex >= HeaderSize)) {
-                readHeader = false;
-                (void)memcpy(&_endFrameIndex, _readBuffer.data(), HeaderSize);
+        if ((header & CompressedFrameFlag) != 0) {
+            CheckResult(Decompress());
+        }
 
-                if (_endFrameIndex > BufferSize) {
-                    throw CoSimException("Protocol error. The buffer size is too small.");
-                }
+        return true;
+    }
 
-                sizeToRead = _endFrameIndex - _writeIndex;
-            }
+    // Replaces the compressed frame by its decompressed data, followed by the data already received behind it
+    [[nodiscard]] bool Decompress() {
+        if (_remainingFrameSize <= CompressedSizeFieldSize) {
+            throw CoSimException("Protocol error. Invalid compressed frame size.");
         }
 
+        int32_t dataSize{};
+        CheckResult(Read(&dataSize, sizeof dataSize));
+        if ((dataSize < 0) || (dataSize > static_cast<int32_t>(MaxChunkSize))) {
+            throw CoSimException("Protocol error. Invalid decompressed frame size.");
+        }
+
+        _compressedBuffer.resize(_remainingFrameSize);
+        CheckResult(Read(_compressedBuffer.data(), _compressedBuffer.size()));
+
+        const int32_t bytesBehindFrame = _writeIndex - _readIndex;
+        _decompressedBuffer.resize(std::max(static_cast<size_t>(dataSize) + bytesBehindFrame,
+                                            static_cast<size_t>(BufferSize)));
+        if (!DsVeosCoSim::Decompress(_compressedBuffer.data(),
+                                     _compressedBuffer.size(),
+                                     _decompressedBuffer.data(),
+                                     dataSize)) {
+            throw CoSimException("Protocol error. Invalid compressed frame.");
+        }
+
+        (void)memcpy(&_decompressedBuffer[dataSize], &_readBuffer[_readIndex], bytesBehindFrame);
+        std::swap(_readBuffer, _decompressedBuffer);
+        _readIndex = 0;
+        _writeIndex = dataSize + bytesBehindFrame;
+        _remainingFrameSize = dataSize;
         return true;
     }
 
+    [[nodiscard]] bool ReceiveIntoBuffer() {
+        int32_t receivedSize{};
+        CheckResult(Receive(&_readBuffer[_writeIndex], BufferSize - _writeIndex, receivedSize));
+        _writeIndex += receivedSize;
+        return true;
+    }
+
+    [[nodiscard]] bool Receive(void* destination, const int32_t size, int32_t& receivedSize) const {
+#ifndef _WIN32
+        if (_ioUring) {
+            return _socket->Receive(*_ioUring, destination, size, receivedSize, _waitMode, _spinTime);
+        }
+#endif
+
+        (void)SpinWait(_waitMode, _spinTime, [this] { return _socket->IsReadable(); });
+        return _socket->Receive(destination, size, receivedSize);
+    }
+
     Socket* _socket{};
+    WaitMode _waitMode{};
+    std::chrono::microseconds _spinTime{};
 
     int32_t _readIndex{};
     int32_t _writeIndex{};
-    int32_t _endFrameIndex{};
+    int32_t _remainingFrameSize{};
     std::vector<uint8_t> _readBuffer;
+    std::vector<uint8_t> _viewBuffer;
+    std::vector<uint8_t> _compressedBuffer;
+    std::vector<uint8_t> _decompressedBuffer;
+#ifndef _WIN32
+    // Declared after the buffers, so a cancelled receive never outlives them
+    std::unique_ptr<IoUring> _ioUring;
+#endif
 };
 
 class SocketChannel final : public Channel {
@@ -198,10 +405,26 @@ public:
         return remoteAddress;
     }
 
+    [[nodiscard]] std::string GetName() const override {
+        return {};
+    }
+
     void Disconnect() override {
         _socket.Shutdown();
     }
 
+    void EnableLargeFrames() override {
+        _writer.EnableLargeFrames();
+    }
+
+    void EnableCompression() override {
+        _writer.EnableCompression();
+    }
+
+    void SetWaitMode(const WaitMode waitMode, const std::chrono::microseconds spinTime) override {
+        _reader.SetWaitMode(waitMode, spinTime);
+    }
+
     [[nodiscard]] ChannelWriter& GetWriter() override {
         return _writer;
     }
@@ -219,12 +442,15 @@ private:
 
 class TcpChannelServer final : public ChannelServer {
 public:
-    TcpChannelServer(const uint16_t port, const bool enableRemoteAccess) : _port(port) {
+    TcpChannelServer(const uint16_t port, const bool enableRemoteAccess, const TcpSocketOptions& socketOptions)
+        : _port(port), _socketOptions(socketOptions) {
         StartupNetwork();
 
+        // Accepted sockets inherit the buffer sizes of the listen socket
         if (Socket::IsIpv4Supported()) {
             _listenSocketIpv4 = Socket(AddressFamily::Ipv4);
             _listenSocketIpv4.EnableReuseAddress();
+            _listenSocketIpv4.ApplyOptions(_socketOptions);
             _listenSocketIpv4.Bind(_port, enableRemoteAccess);
             _port = _listenSocketIpv4.GetLocalPort();
             _listenSocketIpv4.Listen();
@@ -234,6 +460,7 @@ public:
             _listenSocketIpv6 = Socket(AddressFamily::Ipv6);
             _listenSocketIpv6.EnableIpv6Only();
             _listenSocketIpv6.EnableReuseAddress();
+            _listenSocketIpv6.ApplyOptions(_socketOptions);
             _listenSocketIpv6.Bind(_port, enableRemoteAccess);
             _port = _listenSocketIpv6.GetLocalPort();
             _listenSocketIpv6.Listen();
@@ -262,6 +489,7 @@ public:
                 std::optional<Socket> socket = _listenSocketIpv4.TryAccept();
                 if (socket) {
                     socket->EnableNoDelay();
+                    socket->ApplyOptions(_socketOptions);
                     return std::make_unique<SocketChannel>(std::move(*socket));
                 }
             }
@@ -270,6 +498,7 @@ public:
                 std::optional<Socket> socket = _listenSocketIpv6.TryAccept();
                 if (socket) {
                     socket->EnableNoDelay();
+                    socket->ApplyOptions(_socketOptions);
                     return std::make_unique<SocketChannel>(std::move(*socket));
                 }
             }
@@ -286,6 +515,7 @@ public:
 
 private:
     uint16_t _port{};
+    TcpSocketOptions _socketOptions{};
     Socket _listenSocketIpv4;
     Socket _listenSocketIpv6;
 };
@@ -334,11 +564,12 @@ private:
 [[nodiscard]] std::unique_ptr<Channel> TryConnectToTcpChannel(const std::string_view remoteIpAddress,
                                                               const uint16_t remotePort,
                                                               const uint16_t localPort,
-                                                              const uint32_t timeoutInMilliseconds) {
+                                                              const uint32_t timeoutInMilliseconds,
+                                                              const TcpSocketOptions& socketOptions) {
     StartupNetwork();
 
     std::optional<Socket> connectedSocket =  // NOLINT
-        Socket::TryConnect(remoteIpAddress, remotePort, localPort, timeoutInMilliseconds);
+        Socket::TryConnect(remoteIpAddress, remotePort, localPort, timeoutInMilliseconds, socketOptions);
     if (connectedSocket) {
         connectedSocket->EnableNoDelay();
         return std::make_unique<SocketChannel>(std::move(*connectedSocket));
@@ -359,8 +590,9 @@ private:
 }
 
 [[nodiscard]] std::unique_ptr<ChannelServer> CreateTcpChannelServer(const uint16_t port,
-                                                                    const bool enableRemoteAccess) {
-    return std::make_unique<TcpChannelServer>(port, enableRemoteAccess);
+                                                                    const bool enableRemoteAccess,
+                                                                    const TcpSocketOptions& socketOptions) {
+    return std::make_unique<TcpChannelServer>(port, enableRemoteAccess, socketOptions);
 }
 
 [[nodiscard]] std::unique_ptr<ChannelServer> CreateUdsChannelServer(const std::string& name) {
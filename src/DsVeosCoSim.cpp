@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimClient.h"
@@ -386,6 +387,68 @@ DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignal(const DsVeosCoSim_Handle handl
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignals(const DsVeosCoSim_Handle handle,
+                                                   const uint32_t incomingSignalsCount,
+                                                   DsVeosCoSim_IoSignalReadValue* incomingSignals) {
+    CheckNotNull(handle);
+    if (incomingSignalsCount > 0) {
+        CheckNotNull(incomingSignals);
+    }
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        client->ReadSignals(incomingSignalsCount, reinterpret_cast<IoSignalReadValue*>(incomingSignals));
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_GetIncomingSignalHandle(const DsVeosCoSim_Handle handle,
+                                                       const DsVeosCoSim_IoSignalId incomingSignalId,
+                                                       DsVeosCoSim_IoSignalHandle* incomingSignalHandle) {
+    CheckNotNull(handle);
+    CheckNotNull(incomingSignalHandle);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *incomingSignalHandle = static_cast<DsVeosCoSim_IoSignalHandle>(
+            client->GetIncomingSignalHandle(static_cast<IoSignalId>(incomingSignalId)));
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignalFast(const DsVeosCoSim_Handle handle,
+                                                      const DsVeosCoSim_IoSignalHandle incomingSignalHandle,
+                                                      uint32_t* length,
+                                                      void* value) {
+    CheckNotNull(handle);
+    CheckNotNull(length);
+    CheckNotNull(value);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        client->ReadFast(static_cast<IoSignalHandle>(incomingSignalHandle), *length, value);
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 DsVeosCoSim_Result DsVeosCoSim_GetOutgoingSignals(const DsVeosCoSim_Handle handle,
                                                   uint32_t* outgoingSignalsCount,
                                                   const DsVeosCoSim_IoSignal** outgoingSignals) {
@@ -428,6 +491,69 @@ DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignal(const DsVeosCoSim_Handle hand
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignals(const DsVeosCoSim_Handle handle,
+                                                    const uint32_t outgoingSignalsCount,
+                                                    const DsVeosCoSim_IoSignalWriteValue* outgoingSignals) {
+    CheckNotNull(handle);
+    if (outgoingSignalsCount > 0) {
+        CheckNotNull(outgoingSignals);
+    }
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        client->WriteSignals(outgoingSignalsCount, reinterpret_cast<const IoSignalWriteValue*>(outgoingSignals));
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_GetOutgoingSignalHandle(const DsVeosCoSim_Handle handle,
+                                                       const DsVeosCoSim_IoSignalId outgoingSignalId,
+                                                       DsVeosCoSim_IoSignalHandle* outgoingSignalHandle) {
+    CheckNotNull(handle);
+    CheckNotNull(outgoingSignalHandle);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *outgoingSignalHandle = static_cast<DsVeosCoSim_IoSignalHandle>(
+            client->GetOutgoingSignalHandle(static_cast<IoSignalId>(outgoingSignalId)));
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignalFast(const DsVeosCoSim_Handle handle,
+                                                       const DsVeosCoSim_IoSignalHandle outgoingSignalHandle,
+                                                       const uint32_t length,
+                                                       const void* value) {
+    CheckNotNull(handle);
+    if (length > 0) {
+        CheckNotNull(value);
+    }
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        client->WriteFast(static_cast<IoSignalHandle>(outgoingSignalHandle), length, value);
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 DsVeosCoSim_Result DsVeosCoSim_GetCanControllers(const DsVeosCoSim_Handle handle,
                                                  uint32_t* canControllersCount,
                                                  const DsVeosCoSim_CanController** canControllers) {
@@ -487,6 +613,131 @@ DsVeosCoSim_Result DsVeosCoSim_TransmitCanMessage(const DsVeosCoSim_Handle handl
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessages(const DsVeosCoSim_Handle handle,
+                                                  DsVeosCoSim_CanMessage* messages,
+                                                  const uint32_t maxCount,
+                                                  uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(reinterpret_cast<CanMessage*>(messages), maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessageFromController(const DsVeosCoSim_Handle handle,
+                                                               const DsVeosCoSim_BusControllerId controllerId,
+                                                               DsVeosCoSim_CanMessage* message) {
+    CheckNotNull(handle);
+    CheckNotNull(message);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        if (!client->Receive(static_cast<BusControllerId>(controllerId), reinterpret_cast<CanMessage&>(*message))) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveCanMessagesFromController(const DsVeosCoSim_Handle handle,
+                                                                const DsVeosCoSim_BusControllerId controllerId,
+                                                                DsVeosCoSim_CanMessage* messages,
+                                                                const uint32_t maxCount,
+                                                                uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(static_cast<BusControllerId>(controllerId),
+                                             reinterpret_cast<CanMessage*>(messages),
+                                             maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_TransmitCanMessages(const DsVeosCoSim_Handle handle,
+                                                   const DsVeosCoSim_CanMessage* messages,
+                                                   const uint32_t count,
+                                                   uint32_t* transmittedCount) {
+    CheckNotNull(handle);
+    if (count > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(transmittedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *transmittedCount = client->TransmitMany(reinterpret_cast<const CanMessage*>(messages), count);
+        if (*transmittedCount < count) {
+            return DsVeosCoSim_Result_Full;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_SetCanAcceptanceFilter(const DsVeosCoSim_Handle handle,
+                                                      const DsVeosCoSim_BusControllerId controllerId,
+                                                      const DsVeosCoSim_BusMessageIdFilter* filters,
+                                                      const uint32_t filtersCount) {
+    CheckNotNull(handle);
+    if (filtersCount > 0) {
+        CheckNotNull(filters);
+    }
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        const auto* const filtersBegin = reinterpret_cast<const BusMessageIdFilter*>(filters);
+        client->SetCanAcceptanceFilter(static_cast<BusControllerId>(controllerId),
+                                       std::vector<BusMessageIdFilter>(filtersBegin, filtersBegin + filtersCount));
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 DsVeosCoSim_Result DsVeosCoSim_GetEthControllers(const DsVeosCoSim_Handle handle,
                                                  uint32_t* ethControllersCount,
                                                  const DsVeosCoSim_EthController** ethControllers) {
@@ -546,6 +797,108 @@ DsVeosCoSim_Result DsVeosCoSim_TransmitEthMessage(const DsVeosCoSim_Handle handl
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessages(const DsVeosCoSim_Handle handle,
+                                                  DsVeosCoSim_EthMessage* messages,
+                                                  const uint32_t maxCount,
+                                                  uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(reinterpret_cast<EthMessage*>(messages), maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessageFromController(const DsVeosCoSim_Handle handle,
+                                                               const DsVeosCoSim_BusControllerId controllerId,
+                                                               DsVeosCoSim_EthMessage* message) {
+    CheckNotNull(handle);
+    CheckNotNull(message);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        if (!client->Receive(static_cast<BusControllerId>(controllerId), reinterpret_cast<EthMessage&>(*message))) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveEthMessagesFromController(const DsVeosCoSim_Handle handle,
+                                                                const DsVeosCoSim_BusControllerId controllerId,
+                                                                DsVeosCoSim_EthMessage* messages,
+                                                                const uint32_t maxCount,
+                                                                uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(static_cast<BusControllerId>(controllerId),
+                                             reinterpret_cast<EthMessage*>(messages),
+                                             maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_TransmitEthMessages(const DsVeosCoSim_Handle handle,
+                                                   const DsVeosCoSim_EthMessage* messages,
+                                                   const uint32_t count,
+                                                   uint32_t* transmittedCount) {
+    CheckNotNull(handle);
+    if (count > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(transmittedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *transmittedCount = client->TransmitMany(reinterpret_cast<const EthMessage*>(messages), count);
+        if (*transmittedCount < count) {
+            return DsVeosCoSim_Result_Full;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 DsVeosCoSim_Result DsVeosCoSim_GetLinControllers(const DsVeosCoSim_Handle handle,
                                                  uint32_t* linControllersCount,
                                                  const DsVeosCoSim_LinController** linControllers) {
@@ -605,6 +958,131 @@ DsVeosCoSim_Result DsVeosCoSim_TransmitLinMessage(const DsVeosCoSim_Handle handl
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessages(const DsVeosCoSim_Handle handle,
+                                                  DsVeosCoSim_LinMessage* messages,
+                                                  const uint32_t maxCount,
+                                                  uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(reinterpret_cast<LinMessage*>(messages), maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessageFromController(const DsVeosCoSim_Handle handle,
+                                                               const DsVeosCoSim_BusControllerId controllerId,
+                                                               DsVeosCoSim_LinMessage* message) {
+    CheckNotNull(handle);
+    CheckNotNull(message);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        if (!client->Receive(static_cast<BusControllerId>(controllerId), reinterpret_cast<LinMessage&>(*message))) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReceiveLinMessagesFromController(const DsVeosCoSim_Handle handle,
+                                                                const DsVeosCoSim_BusControllerId controllerId,
+                                                                DsVeosCoSim_LinMessage* messages,
+                                                                const uint32_t maxCount,
+                                                                uint32_t* receivedCount) {
+    CheckNotNull(handle);
+    if (maxCount > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(receivedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *receivedCount = client->ReceiveMany(static_cast<BusControllerId>(controllerId),
+                                             reinterpret_cast<LinMessage*>(messages),
+                                             maxCount);
+        if (*receivedCount == 0) {
+            return DsVeosCoSim_Result_Empty;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_TransmitLinMessages(const DsVeosCoSim_Handle handle,
+                                                   const DsVeosCoSim_LinMessage* messages,
+                                                   const uint32_t count,
+                                                   uint32_t* transmittedCount) {
+    CheckNotNull(handle);
+    if (count > 0) {
+        CheckNotNull(messages);
+    }
+    CheckNotNull(transmittedCount);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        *transmittedCount = client->TransmitMany(reinterpret_cast<const LinMessage*>(messages), count);
+        if (*transmittedCount < count) {
+            return DsVeosCoSim_Result_Full;
+        }
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_SetLinAcceptanceFilter(const DsVeosCoSim_Handle handle,
+                                                      const DsVeosCoSim_BusControllerId controllerId,
+                                                      const DsVeosCoSim_BusMessageIdFilter* filters,
+                                                      const uint32_t filtersCount) {
+    CheckNotNull(handle);
+    if (filtersCount > 0) {
+        CheckNotNull(filters);
+    }
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        const auto* const filtersBegin = reinterpret_cast<const BusMessageIdFilter*>(filters);
+        client->SetLinAcceptanceFilter(static_cast<BusControllerId>(controllerId),
+                                       std::vector<BusMessageIdFilter>(filtersBegin, filtersBegin + filtersCount));
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 DsVeosCoSim_Result DsVeosCoSim_StartSimulation(const DsVeosCoSim_Handle handle) {
     CheckNotNull(handle);
 
@@ -704,6 +1182,51 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_GetCurrentSimulationTime(const D
     }
 }
 
+DsVeosCoSim_Result DsVeosCoSim_GetLatencyStatistics(const DsVeosCoSim_Handle handle,
+                                                    const DsVeosCoSim_Command command,
+                                                    const DsVeosCoSim_LatencyPhase phase,
+                                                    DsVeosCoSim_LatencyStatistics* statistics) {
+    CheckNotNull(handle);
+    CheckNotNull(statistics);
+
+    const auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        const LatencyStatistics latencyStatistics =
+            client->GetLatencyStatistics(static_cast<Command>(command), static_cast<LatencyPhase>(phase));
+        statistics->count = latencyStatistics.count;
+        statistics->minimum = latencyStatistics.minimum.count();
+        statistics->maximum = latencyStatistics.maximum.count();
+        statistics->mean = latencyStatistics.mean.count();
+        statistics->p50 = latencyStatistics.p50.count();
+        statistics->p90 = latencyStatistics.p90.count();
+        statistics->p99 = latencyStatistics.p99.count();
+        statistics->p999 = latencyStatistics.p999.count();
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ResetLatencyStatistics(const DsVeosCoSim_Handle handle) {
+    CheckNotNull(handle);
+
+    auto* const client = static_cast<CoSimClient*>(handle);
+
+    try {
+        client->ResetLatencyStatistics();
+
+        return DsVeosCoSim_Result_Ok;
+    } catch (const std::exception& e) {
+        LogError(e.what());
+
+        return DsVeosCoSim_Result_Error;
+    }
+}
+
 std::string DsVeosCoSim_SimulationTimeToString(const DsVeosCoSim_SimulationTime simulationTime) {
     return SimulationTimeToString(SimulationTime(simulationTime));
 }
@@ -716,6 +1239,10 @@ std::string DsVeosCoSim_CommandToString(DsVeosCoSim_Command command) {
     return ToString(static_cast<Command>(command));
 }
 
+std::string DsVeosCoSim_LatencyPhaseToString(const DsVeosCoSim_LatencyPhase latencyPhase) {
+    return ToString(static_cast<LatencyPhase>(latencyPhase));
+}
+
 std::string DsVeosCoSim_SeverityToString(const DsVeosCoSim_Severity severity) {
     return ToString(static_cast<Severity>(severity));
 }
@@ -0,0 +1,211 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#include "Compression.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr size_t MinMatchLength = 4;
+constexpr size_t LastLiteralsLength = 5;
+constexpr size_t MatchFindLimit = 12;
+constexpr size_t MaxOffset = 65535;
+constexpr size_t HashBits = 12;
+constexpr size_t MaxLengthInToken = 15;
+
+[[nodiscard]] uint32_t Load32(const uint8_t* source) {
+    uint32_t value{};
+    (void)memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+[[nodiscard]] uint32_t Hash(const uint32_t sequence) {
+    return (sequence * 2654435761U) >> (32U - HashBits);
+}
+
+[[nodiscard]] uint8_t* WriteLength(uint8_t* destination, size_t length) {
+    while (length >= 255) {
+        *destination++ = 255;
+        length -= 255;
+    }
+
+    *destination++ = static_cast<uint8_t>(length);
+    return destination;
+}
+
+[[nodiscard]] uint8_t* WriteLiterals(uint8_t* destination, const uint8_t* literals, const size_t length) {
+    if (length >= MaxLengthInToken) {
+        destination = WriteLength(destination, length - MaxLengthInToken);
+    }
+
+    (void)memcpy(destination, literals, length);
+    return destination + length;
+}
+
+[[nodiscard]] uint8_t* WriteSequence(uint8_t* destination,
+                                     const uint8_t* literals,
+                                     const size_t literalsLength,
+                                     const size_t offset,
+                                     const size_t matchLength) {
+    const size_t extraMatchLength = matchLength - MinMatchLength;
+
+    uint8_t* token = destination++;
+    *token = static_cast<uint8_t>((std::min(literalsLength, MaxLengthInToken) << 4U) |
+                                  std::min(extraMatchLength, MaxLengthInToken));
+
+    destination = WriteLiterals(destination, literals, literalsLength);
+
+    *destination++ = static_cast<uint8_t>(offset & 0xFFU);
+    *destination++ = static_cast<uint8_t>(offset >> 8U);
+
+    if (extraMatchLength >= MaxLengthInToken) {
+        destination = WriteLength(destination, extraMatchLength - MaxLengthInToken);
+    }
+
+    return destination;
+}
+
+[[nodiscard]] bool ReadLength(const uint8_t*& source, const uint8_t* sourceEnd, size_t& length) {
+    uint8_t byte{};
+    do {
+        if (source == sourceEnd) {
+            return false;
+        }
+
+        byte = *source++;
+        length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+}  // namespace
+
+[[nodiscard]] size_t GetMaxCompressedSize(const size_t size) {
+    return size + (size / 255) + 16;
+}
+
+[[nodiscard]] size_t Compress(const uint8_t* source, const size_t size, uint8_t* destination) {
+    uint8_t* destinationPointer = destination;
+    size_t anchor = 0;
+
+    // The block format requires the last bytes to be literals
+    if (size >= MatchFindLimit) {
+        std::array<uint32_t, size_t{1} << HashBits> positions{};
+
+        const size_t matchLimit = size - LastLiteralsLength;
+        const size_t searchLimit = size - MatchFindLimit;
+        size_t position = 0;
+        while (position < searchLimit) {
+            const uint32_t sequence = Load32(source + position);
+            uint32_t& entry = positions[Hash(sequence)];
+            size_t candidate = entry;
+            entry = static_cast<uint32_t>(position);
+
+            if ((candidate >= position) || ((position - candidate) > MaxOffset) ||
+                (Load32(source + candidate) != sequence)) {
+                // Searches less often the longer no match was found, so incompressible data is skipped fast
+                position += 1 + ((position - anchor) >> 6U);
+                continue;
+            }
+
+            size_t matchEnd = position + MinMatchLength;
+            size_t candidateEnd = candidate + MinMatchLength;
+            while ((matchEnd < matchLimit) && (source[matchEnd] == source[candidateEnd])) {
+                ++matchEnd;
+                ++candidateEnd;
+            }
+
+            while ((position > anchor) && (candidate > 0) && (source[position - 1] == source[candidate - 1])) {
+                --position;
+                --candidate;
+            }
+
+            destinationPointer = WriteSequence(destinationPointer,
+                                               source + anchor,
+                                               position - anchor,
+                                               position - candidate,
+                                               matchEnd - position);
+            position = matchEnd;
+            anchor = position;
+        }
+    }
+
+    const size_t literalsLength = size - anchor;
+    *destinationPointer++ = static_cast<uint8_t>(std::min(literalsLength, MaxLengthInToken) << 4U);
+    destinationPointer = WriteLiterals(destinationPointer, source + anchor, literalsLength);
+    return static_cast<size_t>(destinationPointer - destination);
+}
+
+[[nodiscard]] bool Decompress(const uint8_t* source,
+                              const size_t size,
+                              uint8_t* destination,
+                              const size_t destinationSize) {
+    const uint8_t* sourceEnd = source + size;
+    uint8_t* destinationPointer = destination;
+    const uint8_t* destinationEnd = destination + destinationSize;
+
+    while (source < sourceEnd) {
+        const uint8_t token = *source++;
+
+        size_t literalsLength = token >> 4U;
+        if ((literalsLength == MaxLengthInToken) && !ReadLength(source, sourceEnd, literalsLength)) {
+            return false;
+        }
+
+        if ((literalsLength > static_cast<size_t>(sourceEnd - source)) ||
+            (literalsLength > static_cast<size_t>(destinationEnd - destinationPointer))) {
+            return false;
+        }
+
+        (void)memcpy(destinationPointer, source, literalsLength);
+        source += literalsLength;
+        destinationPointer += literalsLength;
+
+        // The last sequence only consists of literals
+        if (source == sourceEnd) {
+            return destinationPointer == destinationEnd;
+        }
+
+        if ((sourceEnd - source) < 2) {
+            return false;
+        }
+
+        const size_t offset = source[0] | (static_cast<size_t>(source[1]) << 8U);
+        source += 2;
+        if ((offset == 0) || (offset > static_cast<size_t>(destinationPointer - destination))) {
+            return false;
+        }
+
+        size_t matchLength = token & 0x0FU;
+        if ((matchLength == MaxLengthInToken) && !ReadLength(source, sourceEnd, matchLength)) {
+            return false;
+        }
+
+        matchLength += MinMatchLength;
+        if (matchLength > static_cast<size_t>(destinationEnd - destinationPointer)) {
+            return false;
+        }
+
+        // Overlapping matches repeat the last offset bytes, so they are copied byte by byte
+        const uint8_t* match = destinationPointer - offset;
+        if (offset >= matchLength) {
+            (void)memcpy(destinationPointer, match, matchLength);
+            destinationPointer += matchLength;
+        } else {
+            for (size_t i = 0; i < matchLength; i++) {
+                *destinationPointer++ = *match++;
+            }
+        }
+    }
+
+    return false;
+}
+
+}  // namespace DsVeosCoSim
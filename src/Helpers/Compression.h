@@ -0,0 +1,19 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DsVeosCoSim {
+
+// Size of the destination buffer, which Compress needs in the worst case
+[[nodiscard]] size_t GetMaxCompressedSize(size_t size);
+
+// Compresses the source into the LZ4 block format and returns the compressed size
+[[nodiscard]] size_t Compress(const uint8_t* source, size_t size, uint8_t* destination);
+
+// Returns false if the source is no valid LZ4 block, which decompresses to exactly destinationSize bytes
+[[nodiscard]] bool Decompress(const uint8_t* source, size_t size, uint8_t* destination, size_t destinationSize);
+
+}  // namespace DsVeosCoSim
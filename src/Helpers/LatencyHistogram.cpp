@@ -0,0 +1,162 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#include "LatencyHistogram.h"
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "DsVeosCoSim/CoSimTypes.h"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint64_t MaxLatency = (uint64_t{1} << LatencyHistogram::MaxLatencyBits) - 1;
+
+[[nodiscard]] uint32_t GetHighestBit(const uint64_t value) {
+#ifdef _WIN32
+    unsigned long index{};
+    (void)_BitScanReverse64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return 63U - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+}
+
+}  // namespace
+
+void LatencyHistogram::Record(const std::chrono::nanoseconds latency) {
+    const auto value = static_cast<uint64_t>(std::max(latency.count(), int64_t{}));
+
+    _buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t minimum = _minimum.load(std::memory_order_relaxed);
+    while ((value < minimum) && !_minimum.compare_exchange_weak(minimum, value, std::memory_order_relaxed)) {
+    }
+
+    uint64_t maximum = _maximum.load(std::memory_order_relaxed);
+    while ((value > maximum) && !_maximum.compare_exchange_weak(maximum, value, std::memory_order_relaxed)) {
+    }
+}
+
+[[nodiscard]] LatencyStatistics LatencyHistogram::GetStatistics() const {
+    // The buckets are copied first, so concurrent recordings do not shift the percentiles while they are searched
+    std::array<uint64_t, BucketCount> buckets{};
+    uint64_t totalCount{};
+    for (size_t i = 0; i < BucketCount; i++) {
+        buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+        totalCount += buckets[i];
+    }
+
+    LatencyStatistics statistics{};
+    if (totalCount == 0) {
+        return statistics;
+    }
+
+    const uint64_t count = _count.load(std::memory_order_relaxed);
+    const uint64_t maximum = _maximum.load(std::memory_order_relaxed);
+    statistics.count = count;
+    statistics.minimum = std::chrono::nanoseconds(_minimum.load(std::memory_order_relaxed));
+    statistics.maximum = std::chrono::nanoseconds(maximum);
+    statistics.mean = std::chrono::nanoseconds(_sum.load(std::memory_order_relaxed) / std::max(count, uint64_t{1}));
+
+    constexpr size_t PercentileCount = 4;
+    const std::array<double, PercentileCount> quantiles = {0.5, 0.9, 0.99, 0.999};
+    const std::array<std::chrono::nanoseconds*, PercentileCount> percentiles = {&statistics.p50,
+                                                                                 &statistics.p90,
+                                                                                 &statistics.p99,
+                                                                                 &statistics.p999};
+
+    size_t percentileIndex{};
+    uint64_t cumulativeCount{};
+    for (size_t i = 0; (i < BucketCount) && (percentileIndex < PercentileCount); i++) {
+        cumulativeCount += buckets[i];
+        while ((percentileIndex < PercentileCount) &&
+               (static_cast<double>(cumulativeCount) >=
+                (quantiles[percentileIndex] * static_cast<double>(totalCount)))) {
+            *percentiles[percentileIndex] = std::chrono::nanoseconds(std::min(GetHighestLatencyOfBucket(i), maximum));
+            percentileIndex++;
+        }
+    }
+
+    return statistics;
+}
+
+void LatencyHistogram::Reset() {
+    for (std::atomic<uint64_t>& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    _count.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _minimum.store(UINT64_MAX, std::memory_order_relaxed);
+    _maximum.store(0, std::memory_order_relaxed);
+}
+
+[[nodiscard]] size_t LatencyHistogram::GetBucketIndex(uint64_t latency) {
+    latency = std::min(latency, MaxLatency);
+
+    // The first two powers of two are stored exactly
+    if (latency < (SubBucketCount * 2)) {
+        return static_cast<size_t>(latency);
+    }
+
+    const uint32_t shift = GetHighestBit(latency) - SubBucketBits;
+    return static_cast<size_t>((shift * SubBucketCount) + (latency >> shift));
+}
+
+[[nodiscard]] uint64_t LatencyHistogram::GetHighestLatencyOfBucket(const size_t bucketIndex) {
+    if (bucketIndex < (SubBucketCount * 2)) {
+        return bucketIndex;
+    }
+
+    const uint64_t shift = (bucketIndex / SubBucketCount) - 1;
+    const uint64_t subBucket = bucketIndex - (shift * SubBucketCount);
+    return ((subBucket + 1) << shift) - 1;
+}
+
+LatencyRecorder::LatencyRecorder()
+    : _histograms(std::make_unique<std::array<LatencyHistogram, CommandCount * PhaseCount>>()) {
+}
+
+void LatencyRecorder::Record(const Command command, const LatencyPhase phase, Clock::time_point& start) {
+    const Clock::time_point now = Clock::now();
+    Record(command, phase, now - start);
+    start = now;
+}
+
+void LatencyRecorder::Record(const Command command, const LatencyPhase phase, const std::chrono::nanoseconds latency) {
+    (*_histograms)[(static_cast<size_t>(command) * PhaseCount) + static_cast<size_t>(phase)].Record(latency);
+}
+
+[[nodiscard]] LatencyStatistics LatencyRecorder::GetStatistics(const Command command, const LatencyPhase phase) const {
+    if (static_cast<size_t>(command) >= CommandCount) {
+        throw CoSimException("Unknown command " + ToString(command) + ".");
+    }
+
+    if (static_cast<size_t>(phase) >= PhaseCount) {
+        throw CoSimException("Unknown latency phase " + ToString(phase) + ".");
+    }
+
+    return (*_histograms)[(static_cast<size_t>(command) * PhaseCount) + static_cast<size_t>(phase)].GetStatistics();
+}
+
+void LatencyRecorder::Reset() {
+    for (LatencyHistogram& histogram : *_histograms) {
+        histogram.Reset();
+    }
+}
+
+}  // namespace DsVeosCoSim
@@ -0,0 +1,68 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "DsVeosCoSim/CoSimTypes.h"
+
+namespace DsVeosCoSim {
+
+// Log-linear histogram in the style of HdrHistogram. Every power of two is split into 32 buckets, so percentiles have
+// a relative error of at most 1/32. Only relaxed atomics are used, so statistics can be queried from any thread
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SubBucketBits = 5;
+    static constexpr uint64_t SubBucketCount = uint64_t{1} << SubBucketBits;
+
+    // Larger latencies (about 68 seconds) are counted in the last bucket
+    static constexpr uint32_t MaxLatencyBits = 36;
+    static constexpr size_t BucketCount = (MaxLatencyBits - SubBucketBits + 1) * SubBucketCount;
+
+    void Record(std::chrono::nanoseconds latency);
+
+    [[nodiscard]] LatencyStatistics GetStatistics() const;
+
+    void Reset();
+
+    [[nodiscard]] static size_t GetBucketIndex(uint64_t latency);
+    [[nodiscard]] static uint64_t GetHighestLatencyOfBucket(size_t bucketIndex);
+
+private:
+    std::array<std::atomic<uint64_t>, BucketCount> _buckets{};
+    std::atomic<uint64_t> _count{};
+    std::atomic<uint64_t> _sum{};
+    std::atomic<uint64_t> _minimum{UINT64_MAX};
+    std::atomic<uint64_t> _maximum{};
+};
+
+// One histogram per command and phase of the protocol round trips
+class LatencyRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    LatencyRecorder();
+
+    // Records the time since start and restarts the measurement, so consecutive phases can be chained
+    void Record(Command command, LatencyPhase phase, Clock::time_point& start);
+
+    // Records a latency measured by the caller, e.g. one summed up over several clients
+    void Record(Command command, LatencyPhase phase, std::chrono::nanoseconds latency);
+
+    [[nodiscard]] LatencyStatistics GetStatistics(Command command, LatencyPhase phase) const;
+
+    void Reset();
+
+private:
+    static constexpr size_t CommandCount = static_cast<size_t>(Command::Ping) + 1;
+    static constexpr size_t PhaseCount = static_cast<size_t>(LatencyPhase::Callback) + 1;
+
+    std::unique_ptr<std::array<LatencyHistogram, CommandCount * PhaseCount>> _histograms;
+};
+
+}  // namespace DsVeosCoSim
@@ -2,7 +2,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace DsVeosCoSim {
@@ -57,6 +64,41 @@ public:
         ++_size;
     }
 
+    // Copies the items with at most two contiguous copies instead of pushing them one by one
+    void PushBackMany(const T* items, const size_t count) {
+        if (count > (_items.size() - _size)) {
+            throw std::runtime_error("Ring buffer is full.");
+        }
+
+        const size_t firstCount = std::min(count, _items.size() - _writeIndex);
+        std::copy(items, items + firstCount, _items.begin() + static_cast<std::ptrdiff_t>(_writeIndex));
+        std::copy(items + firstCount, items + count, _items.begin());
+
+        _writeIndex += count;
+        if (_writeIndex >= _items.size()) {
+            _writeIndex -= _items.size();
+        }
+
+        _size += count;
+    }
+
+    // Returns the next slot with its old content, so large items are only partially overwritten instead of copied
+    [[nodiscard]] T& PushBackSlot() {
+        if (IsFull()) {
+            throw std::runtime_error("Ring buffer is full.");
+        }
+
+        T& item = _items[_writeIndex];
+
+        ++_writeIndex;
+        if (_writeIndex == _items.size()) {
+            _writeIndex = 0;
+        }
+
+        ++_size;
+        return item;
+    }
+
     [[nodiscard]] T& PopFront() {
         if (IsEmpty()) {
             throw std::runtime_error("Ring buffer is empty.");
@@ -81,4 +123,267 @@ private:
     std::vector<T> _items{};
 };
 
+// Lock-free ring buffer for exactly one producer thread and one consumer thread
+template <typename T>
+class SpscRingBuffer final {
+    static constexpr size_t CacheLineSize = 64;
+
+public:
+    explicit SpscRingBuffer(const size_t capacity) {
+        // One slot always stays empty to distinguish a full buffer from an empty one
+        _items.resize(capacity + 1);
+    }
+
+    ~SpscRingBuffer() noexcept = default;
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    SpscRingBuffer(SpscRingBuffer&&) = delete;
+    SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+    // For the consumer, this is the minimum count of items it can pop
+    [[nodiscard]] size_t Size() const {
+        const size_t writeIndex = _writeIndex.load(std::memory_order_acquire);
+        const size_t readIndex = _readIndex.load(std::memory_order_acquire);
+        if (writeIndex >= readIndex) {
+            return writeIndex - readIndex;
+        }
+
+        return _items.size() - readIndex + writeIndex;
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return _readIndex.load(std::memory_order_acquire) == _writeIndex.load(std::memory_order_acquire);
+    }
+
+    // Producer only
+    [[nodiscard]] bool TryPushBack(T&& item) {
+        const size_t writeIndex = _writeIndex.load(std::memory_order_relaxed);
+        const size_t nextWriteIndex = Next(writeIndex);
+        if (nextWriteIndex == _cachedReadIndex) {
+            _cachedReadIndex = _readIndex.load(std::memory_order_acquire);
+            if (nextWriteIndex == _cachedReadIndex) {
+                return false;
+            }
+        }
+
+        _items[writeIndex] = std::move(item);
+        _writeIndex.store(nextWriteIndex, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    [[nodiscard]] bool TryPopFront(T& item) {
+        const size_t readIndex = _readIndex.load(std::memory_order_relaxed);
+        if (readIndex == _cachedWriteIndex) {
+            _cachedWriteIndex = _writeIndex.load(std::memory_order_acquire);
+            if (readIndex == _cachedWriteIndex) {
+                return false;
+            }
+        }
+
+        item = std::move(_items[readIndex]);
+        _readIndex.store(Next(readIndex), std::memory_order_release);
+        return true;
+    }
+
+private:
+    [[nodiscard]] size_t Next(const size_t index) const {
+        const size_t nextIndex = index + 1;
+        return nextIndex == _items.size() ? 0 : nextIndex;
+    }
+
+    std::vector<T> _items;
+
+    // The producer and the consumer each own a cache line, so they do not invalidate each other on every access
+    alignas(CacheLineSize) std::atomic<size_t> _writeIndex{};
+    size_t _cachedReadIndex{};
+
+    alignas(CacheLineSize) std::atomic<size_t> _readIndex{};
+    size_t _cachedWriteIndex{};
+};
+
+// Ring buffer, which stores a fixed sized header and a variable sized payload per item contiguously in one byte arena.
+// The arena grows on demand up to the given byte budget, so the memory follows the actual payload sizes
+template <typename THeader>
+class ArenaRingBuffer final {
+    static_assert(std::is_trivially_copyable_v<THeader>, "The header must be trivially copyable.");
+
+    static constexpr size_t Alignment = 8;
+    static constexpr size_t MinimumCapacity = 4096;
+
+    // Marks the end of the used arena, when an item did not fit in front of it
+    static constexpr uint32_t WrapMarker = UINT32_MAX;
+
+    struct ItemHeader {
+        uint32_t length;
+        THeader header;
+    };
+
+public:
+    ArenaRingBuffer() = default;
+    explicit ArenaRingBuffer(const size_t maxCapacityInBytes) : _maxCapacity(maxCapacityInBytes) {
+    }
+
+    ~ArenaRingBuffer() noexcept = default;
+
+    ArenaRingBuffer(const ArenaRingBuffer&) = delete;
+    ArenaRingBuffer& operator=(const ArenaRingBuffer&) = delete;
+
+    ArenaRingBuffer(ArenaRingBuffer&& other) noexcept = default;
+    ArenaRingBuffer& operator=(ArenaRingBuffer&& other) noexcept = default;
+
+    // Bytes, which one item with the given payload length occupies in the arena
+    [[nodiscard]] static constexpr size_t GetItemSize(const size_t length) {
+        return (sizeof(ItemHeader) + length + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    // Byte budget, which always holds count items of up to maxLength bytes. The additional item covers the free space
+    // being split between the end and the start of the arena
+    [[nodiscard]] static constexpr size_t GetRequiredCapacity(const size_t count, const size_t maxLength) {
+        return (count + 1) * GetItemSize(maxLength);
+    }
+
+    void Clear() {
+        _readOffset = 0;
+        _writeOffset = 0;
+        _usedBytes = 0;
+        _size = 0;
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool IsEmpty() const {
+        return _size == 0;
+    }
+
+    [[nodiscard]] size_t Capacity() const {
+        return _bytes.size();
+    }
+
+    void PushBack(const THeader& header, const uint8_t* data, const uint32_t length) {
+        const size_t itemSize = GetItemSize(length);
+
+        size_t offset{};
+        if (!TryAllocate(itemSize, offset)) {
+            Grow(itemSize);
+            if (!TryAllocate(itemSize, offset)) {
+                throw std::runtime_error("Arena ring buffer is full.");
+            }
+        }
+
+        const ItemHeader itemHeader{length, header};
+        (void)memcpy(&_bytes[offset], &itemHeader, sizeof(itemHeader));
+        if (length > 0) {
+            (void)memcpy(&_bytes[offset + sizeof(ItemHeader)], data, length);
+        }
+
+        _writeOffset = offset + itemSize;
+        _usedBytes += itemSize;
+        ++_size;
+    }
+
+    // The returned payload stays valid until the next push
+    [[nodiscard]] const uint8_t* PopFront(THeader& header, uint32_t& length) {
+        if (IsEmpty()) {
+            throw std::runtime_error("Arena ring buffer is empty.");
+        }
+
+        _readOffset = GetItemOffset(_readOffset);
+
+        ItemHeader itemHeader{};
+        (void)memcpy(&itemHeader, &_bytes[_readOffset], sizeof(itemHeader));
+        header = itemHeader.header;
+        length = itemHeader.length;
+        const uint8_t* data = &_bytes[_readOffset + sizeof(ItemHeader)];
+
+        const size_t itemSize = GetItemSize(length);
+        _readOffset += itemSize;
+        _usedBytes -= itemSize;
+        --_size;
+        return data;
+    }
+
+private:
+    // Skips the unused end of the arena, if the item was written to the start
+    [[nodiscard]] size_t GetItemOffset(const size_t offset) const {
+        if ((_bytes.size() - offset) < sizeof(ItemHeader)) {
+            return 0;
+        }
+
+        uint32_t length{};
+        (void)memcpy(&length, &_bytes[offset], sizeof(length));
+        return length == WrapMarker ? 0 : offset;
+    }
+
+    [[nodiscard]] bool TryAllocate(const size_t itemSize, size_t& offset) {
+        if (IsEmpty()) {
+            _readOffset = 0;
+            _writeOffset = 0;
+        }
+
+        const size_t capacity = _bytes.size();
+        const bool isWrapped = (_writeOffset < _readOffset) || ((_writeOffset == _readOffset) && !IsEmpty());
+        if (isWrapped) {
+            offset = _writeOffset;
+            return (_readOffset - _writeOffset) >= itemSize;
+        }
+
+        if ((capacity - _writeOffset) >= itemSize) {
+            offset = _writeOffset;
+            return true;
+        }
+
+        if (_readOffset < itemSize) {
+            return false;
+        }
+
+        if ((capacity - _writeOffset) >= sizeof(ItemHeader)) {
+            const uint32_t wrapMarker = WrapMarker;
+            (void)memcpy(&_bytes[_writeOffset], &wrapMarker, sizeof(wrapMarker));
+        }
+
+        offset = 0;
+        return true;
+    }
+
+    // Moves all items to the start of a larger arena
+    void Grow(const size_t itemSize) {
+        const size_t capacity =
+            std::min(_maxCapacity, std::max({_bytes.size() * 2, _usedBytes + itemSize, MinimumCapacity}));
+        if (capacity <= _bytes.size()) {
+            return;
+        }
+
+        std::vector<uint8_t> bytes(capacity);
+        size_t readOffset = _readOffset;
+        size_t writeOffset = 0;
+        for (size_t i = 0; i < _size; i++) {
+            readOffset = GetItemOffset(readOffset);
+
+            uint32_t length{};
+            (void)memcpy(&length, &_bytes[readOffset], sizeof(length));
+            const size_t size = GetItemSize(length);
+            (void)memcpy(&bytes[writeOffset], &_bytes[readOffset], size);
+
+            readOffset += size;
+            writeOffset += size;
+        }
+
+        _bytes = std::move(bytes);
+        _readOffset = 0;
+        _writeOffset = writeOffset;
+    }
+
+    size_t _maxCapacity{};
+    size_t _readOffset{};
+    size_t _writeOffset{};
+    size_t _usedBytes{};
+    size_t _size{};
+    std::vector<uint8_t> _bytes;
+};
+
 }  // namespace DsVeosCoSim
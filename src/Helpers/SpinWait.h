@@ -0,0 +1,38 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+#include "DsVeosCoSim/CoSimTypes.h"
+
+namespace DsVeosCoSim {
+
+// Polls isReady before the caller blocks. Returns false if the caller still has to block
+template <typename TPredicate>
+[[nodiscard]] bool SpinWait(const WaitMode waitMode, const std::chrono::microseconds spinTime, TPredicate isReady) {
+    if (waitMode == WaitMode::Block) {
+        return false;
+    }
+
+    const auto spinDeadline = std::chrono::steady_clock::now() + spinTime;
+    do {
+        if (isReady()) {
+            return true;
+        }
+    } while (std::chrono::steady_clock::now() < spinDeadline);
+
+    const auto yieldDeadline = spinDeadline + spinTime;
+    do {
+        if (isReady()) {
+            return true;
+        }
+
+        std::this_thread::yield();
+    } while (std::chrono::steady_clock::now() < yieldDeadline);
+
+    return false;
+}
+
+}  // namespace DsVeosCoSim
@@ -15,16 +15,58 @@
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "Environment.h"
+#include "Protocol.h"
 #include "RingBuffer.h"
-
-#ifdef _WIN32
 #include "SharedMemory.h"
-#endif
 
 namespace DsVeosCoSim {
 
 namespace {
 
+// Above this ratio of the highest signal id to the signal count, the ids are looked up in a hash map
+constexpr size_t MaxSignalIdsPerSignal = 4;
+
+// Large signals are compared and copied in blocks, so only the blocks that actually changed are written
+constexpr size_t CompareBlockSize = 1024;
+
+enum class DataEncoding : uint8_t {
+    Full,
+    ChangedBlocks
+};
+
+[[nodiscard]] size_t GetBlockCount(const size_t size) {
+    return (size + CompareBlockSize - 1) / CompareBlockSize;
+}
+
+[[nodiscard]] bool IsBlockChanged(const std::vector<uint8_t>& changedBlocks, const size_t blockIndex) {
+    return (changedBlocks[blockIndex / 8] & (1U << (blockIndex % 8))) != 0;
+}
+
+// The changed blocks bit set is optional and only updated for signals that use the changed blocks encoding
+[[nodiscard]] bool CompareAndCopy(uint8_t* destination,
+                                  const uint8_t* source,
+                                  const size_t size,
+                                  std::vector<uint8_t>& changedBlocks) {
+    bool changed{};
+    size_t offset{};
+    while (offset < size) {
+        const size_t blockSize = std::min(CompareBlockSize, size - offset);
+        if (memcmp(destination + offset, source + offset, blockSize) != 0) {
+            (void)memcpy(destination + offset, source + offset, blockSize);
+            changed = true;
+
+            if (!changedBlocks.empty()) {
+                const size_t blockIndex = offset / CompareBlockSize;
+                changedBlocks[blockIndex / 8] |= static_cast<uint8_t>(1U << (blockIndex % 8));
+            }
+        }
+
+        offset += blockSize;
+    }
+
+    return changed;
+}
+
 void CheckSizeKind(const SizeKind sizeKind, const std::string& name) {
     switch (sizeKind) {
         case SizeKind::Fixed:
@@ -47,7 +89,10 @@ protected:
 public:
     IoPartBufferBase(const CoSimType coSimType, const std::vector<IoSignal>& signals)
         : _coSimType(coSimType), _changedSignalsQueue(signals.size()) {
-        size_t nextSignalIndex = 0;
+        // The changed signals queue points into this vector, so it must never reallocate
+        _metaDataVector.reserve(signals.size());
+
+        size_t maxSignalId = 0;
         for (const auto& signal : signals) {
             if (signal.length == 0) {
                 throw CoSimException("Invalid length 0 for IO signal '" + std::string(signal.name) + "'.");
@@ -71,9 +116,20 @@ public:
             metaData.info = signal;
             metaData.dataTypeSize = dataTypeSize;
             metaData.totalDataSize = totalDataSize;
-            metaData.signalIndex = nextSignalIndex++;
+            metaData.signalIndex = _metaDataVector.size();
+
+            _metaDataLookup[signal.id] = &_metaDataVector.emplace_back(metaData);
+            maxSignalId = std::max(maxSignalId, static_cast<size_t>(signal.id));
+        }
+
+        // Signal ids are usually assigned densely, so most of the time they can directly index a table
+        if (!signals.empty() && (maxSignalId < signals.size() * MaxSignalIdsPerSignal)) {
+            _metaDataById.resize(maxSignalId + 1);
+            for (auto& metaData : _metaDataVector) {
+                _metaDataById[static_cast<size_t>(metaData.info.id)] = &metaData;
+            }
 
-            _metaDataLookup[signal.id] = metaData;
+            _metaDataLookup.clear();
         }
     }
 
@@ -95,34 +151,69 @@ public:
         ClearDataInternal();
     }
 
-    void Write(const IoSignalId signalId, const uint32_t length, const void* value) {
+    void ResetChangedBlocks() {
         if (_coSimType == CoSimType::Client) {
             std::lock_guard lock(_mutex);
-            WriteInternal(signalId, length, value);
+            ResetChangedBlocksInternal();
             return;
         }
 
-        WriteInternal(signalId, length, value);
+        ResetChangedBlocksInternal();
+    }
+
+    [[nodiscard]] IoSignalHandle GetHandle(const IoSignalId signalId) {
+        return static_cast<IoSignalHandle>(FindMetaData(signalId).signalIndex);
+    }
+
+    void Write(const IoSignalId signalId, const uint32_t length, const void* value) {
+        MetaData& metaData = FindMetaData(signalId);
+        CheckLength(metaData, length);
+
+        WriteData(metaData, length, value);
     }
 
     void Read(const IoSignalId signalId, uint32_t& length, void* value) {
+        ReadData(FindMetaData(signalId), length, value);
+    }
+
+    void Read(const IoSignalId signalId, uint32_t& length, const void** value) {
+        ReadData(FindMetaData(signalId), length, value);
+    }
+
+    void WriteSignals(const uint32_t signalsCount, const IoSignalWriteValue* signals) {
         if (_coSimType == CoSimType::Client) {
             std::lock_guard lock(_mutex);
-            ReadInternal(signalId, length, value);
+            WriteSignalsInternal(signalsCount, signals);
             return;
         }
 
-        ReadInternal(signalId, length, value);
+        WriteSignalsInternal(signalsCount, signals);
     }
 
-    void Read(const IoSignalId signalId, uint32_t& length, const void** value) {
+    void ReadSignals(const uint32_t signalsCount, IoSignalReadValue* signals) {
         if (_coSimType == CoSimType::Client) {
             std::lock_guard lock(_mutex);
-            ReadInternal(signalId, length, value);
+            ReadSignalsInternal(signalsCount, signals);
             return;
         }
 
-        ReadInternal(signalId, length, value);
+        ReadSignalsInternal(signalsCount, signals);
+    }
+
+    // The handle is the signal index, so it only needs a bounds check instead of a lookup
+    void WriteFast(const IoSignalHandle signalHandle, const uint32_t length, const void* value) {
+        MetaData& metaData = FindMetaData(signalHandle);
+        CheckLength(metaData, length);
+
+        WriteData(metaData, length, value);
+    }
+
+    void ReadFast(const IoSignalHandle signalHandle, uint32_t& length, void* value) {
+        ReadData(FindMetaData(signalHandle), length, value);
+    }
+
+    void ReadFast(const IoSignalHandle signalHandle, uint32_t& length, const void** value) {
+        ReadData(FindMetaData(signalHandle), length, value);
     }
 
     [[nodiscard]] bool Serialize(ChannelWriter& writer) {
@@ -147,10 +238,12 @@ public:
 
 protected:
     virtual void ClearDataInternal() = 0;
+    virtual void ResetChangedBlocksInternal() = 0;
 
-    virtual void WriteInternal(IoSignalId signalId, uint32_t length, const void* value) = 0;
-    virtual void ReadInternal(IoSignalId signalId, uint32_t& length, void* value) = 0;
-    virtual void ReadInternal(IoSignalId signalId, uint32_t& length, const void** value) = 0;
+    // Returns true, if the signal changed for the first time since the last serialization and must be queued
+    [[nodiscard]] virtual bool WriteInternal(MetaData& metaData, uint32_t length, const void* value) = 0;
+    virtual void ReadInternal(const MetaData& metaData, uint32_t& length, void* value) = 0;
+    virtual void ReadInternal(const MetaData& metaData, uint32_t& length, const void** value) = 0;
 
     [[nodiscard]] virtual bool SerializeInternal(ChannelWriter& writer) = 0;
     [[nodiscard]] virtual bool DeserializeInternal(ChannelReader& reader,
@@ -158,19 +251,120 @@ protected:
                                                    const Callbacks& callbacks) = 0;
 
     [[nodiscard]] MetaData& FindMetaData(const IoSignalId signalId) {
-        const auto search = _metaDataLookup.find(signalId);
-        if (search != _metaDataLookup.end()) {
-            return search->second;
+        if (!_metaDataById.empty()) {
+            const auto index = static_cast<size_t>(signalId);
+            if ((index < _metaDataById.size()) && _metaDataById[index]) {
+                return *_metaDataById[index];
+            }
+        } else {
+            const auto search = _metaDataLookup.find(signalId);
+            if (search != _metaDataLookup.end()) {
+                return *search->second;
+            }
         }
 
         throw CoSimException("IO signal id " + ToString(signalId) + " is unknown.");
     }
 
+    [[nodiscard]] MetaData& FindMetaData(const IoSignalHandle signalHandle) {
+        const auto index = static_cast<size_t>(signalHandle);
+        if (index < _metaDataVector.size()) {
+            return _metaDataVector[index];
+        }
+
+        throw CoSimException("IO signal handle " + std::to_string(index) + " is unknown.");
+    }
+
     CoSimType _coSimType{};
-    std::unordered_map<IoSignalId, MetaData> _metaDataLookup;
+    std::vector<MetaData> _metaDataVector;
     RingBuffer<MetaData*> _changedSignalsQueue;
 
 private:
+    static void CheckLength(const MetaData& metaData, const uint32_t length) {
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            if (length > metaData.info.length) {
+                throw CoSimException("Length of variable sized IO signal '" + std::string(metaData.info.name) +
+                                     "' exceeds max size.");
+            }
+        } else {
+            if (length != metaData.info.length) {
+                throw CoSimException("Length of fixed sized IO signal '" + std::string(metaData.info.name) +
+                                     "' must be " + std::to_string(metaData.info.length) + " but was " +
+                                     std::to_string(length) + ".");
+            }
+        }
+    }
+
+    void WriteSignalsInternal(const uint32_t signalsCount, const IoSignalWriteValue* signals) {
+        // The whole batch is validated first, so an invalid signal does not leave the batch partially written
+        _batchMetaData.clear();
+        for (uint32_t i = 0; i < signalsCount; i++) {
+            MetaData& metaData = FindMetaData(signals[i].id);
+            CheckLength(metaData, signals[i].length);
+            _batchMetaData.push_back(&metaData);
+        }
+
+        size_t changedCount = 0;
+        for (uint32_t i = 0; i < signalsCount; i++) {
+            MetaData* metaData = _batchMetaData[i];
+            if (WriteInternal(*metaData, signals[i].length, signals[i].value)) {
+                _batchMetaData[changedCount++] = metaData;
+            }
+        }
+
+        _changedSignalsQueue.PushBackMany(_batchMetaData.data(), changedCount);
+    }
+
+    void ReadSignalsInternal(const uint32_t signalsCount, IoSignalReadValue* signals) {
+        for (uint32_t i = 0; i < signalsCount; i++) {
+            IoSignalReadValue& signal = signals[i];
+            ReadInternal(FindMetaData(signal.id), signal.length, signal.value);
+        }
+    }
+
+    void WriteData(MetaData& metaData, const uint32_t length, const void* value) {
+        if (_coSimType == CoSimType::Client) {
+            std::lock_guard lock(_mutex);
+            WriteAndQueue(metaData, length, value);
+            return;
+        }
+
+        WriteAndQueue(metaData, length, value);
+    }
+
+    void WriteAndQueue(MetaData& metaData, const uint32_t length, const void* value) {
+        if (WriteInternal(metaData, length, value)) {
+            _changedSignalsQueue.PushBack(&metaData);
+        }
+    }
+
+    void ReadData(const MetaData& metaData, uint32_t& length, void* value) {
+        if (_coSimType == CoSimType::Client) {
+            std::lock_guard lock(_mutex);
+            ReadInternal(metaData, length, value);
+            return;
+        }
+
+        ReadInternal(metaData, length, value);
+    }
+
+    void ReadData(const MetaData& metaData, uint32_t& length, const void** value) {
+        if (_coSimType == CoSimType::Client) {
+            std::lock_guard lock(_mutex);
+            ReadInternal(metaData, length, value);
+            return;
+        }
+
+        ReadInternal(metaData, length, value);
+    }
+
+    // Either the dense table indexed by signal id or the hash map for sparse signal ids is filled
+    std::vector<MetaData*> _metaDataById;
+    std::unordered_map<IoSignalId, MetaData*> _metaDataLookup;
+
+    // Reused by the batched write, so it does not allocate per batch
+    std::vector<MetaData*> _batchMetaData;
+
     std::mutex _mutex;
 };
 
@@ -179,21 +373,31 @@ class RemoteIoPartBuffer final : public IoPartBufferBase {
         uint32_t currentLength{};
         bool isChanged{};
         std::vector<uint8_t> buffer;
+
+        // One bit per block, which is set if the block differs from the counterpart's copy
+        std::vector<uint8_t> changedBlocks;
     };
 
 public:
     RemoteIoPartBuffer(const CoSimType coSimType,
                        [[maybe_unused]] const std::string& name,
-                       const std::vector<IoSignal>& signals)
-        : IoPartBufferBase(coSimType, signals) {
-        _dataVector.resize(_metaDataLookup.size());
-        for (auto& [signalId, metaData] : _metaDataLookup) {
+                       const std::vector<IoSignal>& signals,
+                       const bool useChangedBlocksEncoding,
+                       const bool useCompactEncoding)
+        : IoPartBufferBase(coSimType, signals), _useCompactEncoding(useCompactEncoding) {
+        _dataVector.resize(_metaDataVector.size());
+        for (auto& metaData : _metaDataVector) {
             Data data{};
             data.buffer.resize(metaData.totalDataSize);
             if (metaData.info.sizeKind == SizeKind::Fixed) {
                 data.currentLength = metaData.info.length;
             }
 
+            // Signals with a single block are always sent in full
+            if (useChangedBlocksEncoding && (metaData.totalDataSize > CompareBlockSize)) {
+                data.changedBlocks.resize((GetBlockCount(metaData.totalDataSize) + 7) / 8);
+            }
+
             _dataVector[metaData.signalIndex] = data;
         }
     }
@@ -209,8 +413,8 @@ protected:
     void ClearDataInternal() override {
         _changedSignalsQueue.Clear();
 
-        for (auto& [signalId, metaData] : _metaDataLookup) {
-            auto& [currentLength, isChanged, buffer] = _dataVector[metaData.signalIndex];
+        for (auto& metaData : _metaDataVector) {
+            auto& [currentLength, isChanged, buffer, changedBlocks] = _dataVector[metaData.signalIndex];
             isChanged = false;
             if (metaData.info.sizeKind == SizeKind::Variable) {
                 currentLength = 0;
@@ -218,51 +422,41 @@ protected:
 
             std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0));  // NOLINT
         }
-    }
 
-    void WriteInternal(const IoSignalId signalId, const uint32_t length, const void* value) override {
-        MetaData& metaData = FindMetaData(signalId);
-        auto& [currentLength, isChanged, buffer] = _dataVector[metaData.signalIndex];
+        // The counterpart does not necessarily clear its copy at the same time
+        ResetChangedBlocksInternal();
+    }
 
-        if (metaData.info.sizeKind == SizeKind::Variable) {
-            if (length > metaData.info.length) {
-                throw CoSimException("Length of variable sized IO signal '" + std::string(metaData.info.name) +
-                                     "' exceeds max size.");
-            }
+    void ResetChangedBlocksInternal() override {
+        for (auto& data : _dataVector) {
+            std::fill(data.changedBlocks.begin(), data.changedBlocks.end(), static_cast<uint8_t>(0xFF));  // NOLINT
+        }
+    }
 
-            if (currentLength != length) {
-                if (!isChanged) {
-                    isChanged = true;
-                    _changedSignalsQueue.PushBack(&metaData);
-                }
-            }
+    [[nodiscard]] bool WriteInternal(MetaData& metaData, const uint32_t length, const void* value) override {
+        auto& [currentLength, isChanged, buffer, changedBlocks] = _dataVector[metaData.signalIndex];
 
+        bool changed{};
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            changed = currentLength != length;
             currentLength = length;
-        } else {
-            if (length != metaData.info.length) {
-                throw CoSimException("Length of fixed sized IO signal '" + std::string(metaData.info.name) +
-                                     "' must be " + std::to_string(metaData.info.length) + " but was " +
-                                     std::to_string(length) + ".");
-            }
         }
 
         const size_t totalSize = metaData.dataTypeSize * length;
 
-        const int32_t compareResult = memcmp(buffer.data(), value, totalSize);
-        if (compareResult == 0) {
-            return;
+        if (CompareAndCopy(buffer.data(), static_cast<const uint8_t*>(value), totalSize, changedBlocks)) {
+            changed = true;
         }
 
-        (void)memcpy(buffer.data(), value, totalSize);
-
-        if (!isChanged) {
-            isChanged = true;
-            _changedSignalsQueue.PushBack(&metaData);
+        if (!changed || isChanged) {
+            return false;
         }
+
+        isChanged = true;
+        return true;
     }
 
-    void ReadInternal(const IoSignalId signalId, uint32_t& length, void* value) override {
-        const MetaData& metaData = FindMetaData(signalId);
+    void ReadInternal(const MetaData& metaData, uint32_t& length, void* value) override {
         const Data& data = _dataVector[metaData.signalIndex];
 
         length = data.currentLength;
@@ -270,8 +464,7 @@ protected:
         (void)memcpy(value, data.buffer.data(), totalSize);
     }
 
-    void ReadInternal(const IoSignalId signalId, uint32_t& length, const void** value) override {
-        const MetaData& metaData = FindMetaData(signalId);
+    void ReadInternal(const MetaData& metaData, uint32_t& length, const void** value) override {
         const Data& data = _dataVector[metaData.signalIndex];
 
         length = data.currentLength;
@@ -280,25 +473,37 @@ protected:
 
     [[nodiscard]] bool SerializeInternal(ChannelWriter& writer) override {
         const auto size = static_cast<uint32_t>(_changedSignalsQueue.Size());
-        CheckResultWithMessage(writer.Write(size), "Could not write count of changed signals.");
+        CheckResultWithMessage(WriteNumber(writer, size), "Could not write count of changed signals.");
         if (_changedSignalsQueue.IsEmpty()) {
             return true;
         }
 
         while (!_changedSignalsQueue.IsEmpty()) {
             const MetaData* metaData = _changedSignalsQueue.PopFront();
-            auto& [currentLength, isChanged, buffer] = _dataVector[metaData->signalIndex];
+            Data& data = _dataVector[metaData->signalIndex];
+            const uint32_t currentLength = data.currentLength;
+            const std::vector<uint8_t>& buffer = data.buffer;
 
-            CheckResultWithMessage(writer.Write(metaData->info.id), "Could not write signal id.");
+            if (_useCompactEncoding) {
+                CheckResultWithMessage(writer.WriteVarint(metaData->signalIndex), "Could not write signal index.");
+            } else {
+                CheckResultWithMessage(writer.Write(metaData->info.id), "Could not write signal id.");
+            }
 
             if (metaData->info.sizeKind == SizeKind::Variable) {
-                CheckResultWithMessage(writer.Write(currentLength), "Could not write current signal length.");
+                CheckResultWithMessage(WriteNumber(writer, currentLength), "Could not write current signal length.");
             }
 
             const size_t totalSize = metaData->dataTypeSize * currentLength;
-            CheckResultWithMessage(writer.Write(buffer.data(), static_cast<uint32_t>(totalSize)),
-                                   "Could not write signal data.");
-            isChanged = false;
+            if (data.changedBlocks.empty()) {
+                CheckResultWithMessage(writer.Write(buffer.data(), static_cast<uint32_t>(totalSize)),
+                                       "Could not write signal data.");
+            } else {
+                CheckResultWithMessage(WriteChangedData(writer, *metaData, data, totalSize),
+                                       "Could not write signal data.");
+            }
+
+            data.isChanged = false;
 
             if (IsProtocolTracingEnabled()) {
                 LogProtocolDataTrace("Signal { Id: " + std::to_string(static_cast<uint32_t>(metaData->info.id)) +
@@ -314,18 +519,18 @@ protected:
                                            const SimulationTime simulationTime,
                                            const Callbacks& callbacks) override {
         uint32_t ioSignalChangedCount = 0;
-        CheckResultWithMessage(reader.Read(ioSignalChangedCount), "Could not read count of changed signals.");
+        CheckResultWithMessage(ReadNumber(reader, ioSignalChangedCount), "Could not read count of changed signals.");
 
         for (uint32_t i = 0; i < ioSignalChangedCount; i++) {
-            IoSignalId signalId{};
-            CheckResultWithMessage(reader.Read(signalId), "Could not read signal id.");
+            MetaData* metaDataPointer{};
+            CheckResultWithMessage(ReadSignal(reader, metaDataPointer), "Could not read signal.");
 
-            MetaData& metaData = FindMetaData(signalId);
+            MetaData& metaData = *metaDataPointer;
             Data& data = _dataVector[metaData.signalIndex];
 
             if (metaData.info.sizeKind == SizeKind::Variable) {
                 uint32_t length = 0;
-                CheckResultWithMessage(reader.Read(length), "Could not read current signal length.");
+                CheckResultWithMessage(ReadNumber(reader, length), "Could not read current signal length.");
                 if (length > metaData.info.length) {
                     throw CoSimException("Length of variable sized IO signal '" + std::string(metaData.info.name) +
                                          "' exceeds max size.");
@@ -335,7 +540,12 @@ protected:
             }
 
             const size_t totalSize = metaData.dataTypeSize * data.currentLength;
-            CheckResultWithMessage(reader.Read(data.buffer.data(), totalSize), "Could not read signal data.");
+            if (data.changedBlocks.empty()) {
+                CheckResultWithMessage(reader.Read(data.buffer.data(), totalSize), "Could not read signal data.");
+            } else {
+                CheckResultWithMessage(ReadChangedData(reader, metaData, data, totalSize),
+                                       "Could not read signal data.");
+            }
 
             if (IsProtocolTracingEnabled()) {
                 LogProtocolDataTrace(
@@ -356,11 +566,122 @@ protected:
     }
 
 private:
+    // The compact encoding sends counts and lengths as varints
+    [[nodiscard]] bool WriteNumber(ChannelWriter& writer, const uint32_t value) const {
+        if (_useCompactEncoding) {
+            return writer.WriteVarint(value);
+        }
+
+        return writer.Write(value);
+    }
+
+    [[nodiscard]] bool ReadNumber(ChannelReader& reader, uint32_t& value) const {
+        if (_useCompactEncoding) {
+            return reader.ReadVarint(value);
+        }
+
+        return reader.Read(value);
+    }
+
+    // The compact encoding identifies a signal by its index instead of its id
+    [[nodiscard]] bool ReadSignal(ChannelReader& reader, MetaData*& metaData) {
+        if (!_useCompactEncoding) {
+            IoSignalId signalId{};
+            CheckResult(reader.Read(signalId));
+            metaData = &FindMetaData(signalId);
+            return true;
+        }
+
+        size_t signalIndex{};
+        CheckResult(reader.ReadVarint(signalIndex));
+        if (signalIndex >= _metaDataVector.size()) {
+            throw CoSimException("IO signal index " + std::to_string(signalIndex) + " is unknown.");
+        }
+
+        metaData = &_metaDataVector[signalIndex];
+        return true;
+    }
+
+    // Either sends the data up to the current length or only the changed blocks, whatever is smaller
+    [[nodiscard]] static bool WriteChangedData(ChannelWriter& writer,
+                                               const MetaData& metaData,
+                                               Data& data,
+                                               const size_t totalSize) {
+        std::vector<uint8_t>& changedBlocks = data.changedBlocks;
+
+        size_t changedBlocksSize = changedBlocks.size();
+        const size_t blockCount = GetBlockCount(metaData.totalDataSize);
+        for (size_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+            if (IsBlockChanged(changedBlocks, blockIndex)) {
+                changedBlocksSize += GetBlockSize(metaData, blockIndex);
+            }
+        }
+
+        if (changedBlocksSize >= totalSize) {
+            CheckResult(writer.Write(DataEncoding::Full));
+            CheckResult(writer.Write(data.buffer.data(), totalSize));
+
+            // Blocks behind the current length were not sent, so they stay changed
+            for (size_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+                if ((blockIndex * CompareBlockSize) + GetBlockSize(metaData, blockIndex) <= totalSize) {
+                    changedBlocks[blockIndex / 8] &= static_cast<uint8_t>(~(1U << (blockIndex % 8)));
+                }
+            }
+
+            return true;
+        }
+
+        CheckResult(writer.Write(DataEncoding::ChangedBlocks));
+        CheckResult(writer.Write(changedBlocks.data(), changedBlocks.size()));
+        for (size_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+            if (IsBlockChanged(changedBlocks, blockIndex)) {
+                CheckResult(writer.Write(data.buffer.data() + (blockIndex * CompareBlockSize),
+                                         GetBlockSize(metaData, blockIndex)));
+            }
+        }
+
+        std::fill(changedBlocks.begin(), changedBlocks.end(), static_cast<uint8_t>(0));  // NOLINT
+        return true;
+    }
+
+    [[nodiscard]] bool ReadChangedData(ChannelReader& reader,
+                                       const MetaData& metaData,
+                                       Data& data,
+                                       const size_t totalSize) {
+        DataEncoding encoding{};
+        CheckResult(reader.Read(encoding));
+        if (encoding == DataEncoding::Full) {
+            return reader.Read(data.buffer.data(), totalSize);
+        }
+
+        if (encoding != DataEncoding::ChangedBlocks) {
+            throw CoSimException("Unknown data encoding for IO signal '" + std::string(metaData.info.name) + "'.");
+        }
+
+        // The blocks are patched in place, so the buffer has to contain the previously received data
+        _receivedChangedBlocks.resize(data.changedBlocks.size());
+        CheckResult(reader.Read(_receivedChangedBlocks.data(), _receivedChangedBlocks.size()));
+
+        const size_t blockCount = GetBlockCount(metaData.totalDataSize);
+        for (size_t blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+            if (IsBlockChanged(_receivedChangedBlocks, blockIndex)) {
+                CheckResult(reader.Read(data.buffer.data() + (blockIndex * CompareBlockSize),
+                                        GetBlockSize(metaData, blockIndex)));
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static size_t GetBlockSize(const MetaData& metaData, const size_t blockIndex) {
+        return std::min(CompareBlockSize, metaData.totalDataSize - (blockIndex * CompareBlockSize));
+    }
+
     std::vector<Data> _dataVector;
+    std::vector<uint8_t> _receivedChangedBlocks;
+    bool _useCompactEncoding{};
 };
 
-#ifdef _WIN32
-
 class LocalIoPartBuffer final : public IoPartBufferBase {
     struct DataBuffer {
         uint32_t currentLength{};
@@ -383,10 +704,10 @@ public:
         //   [ current length ]
         //   [ data ]
 
-        _dataVector.resize(_metaDataLookup.size());
+        _dataVector.resize(_metaDataVector.size());
 
         size_t totalSize{};
-        for (auto& [signalId, metaData] : _metaDataLookup) {
+        for (auto& metaData : _metaDataVector) {
             Data data{};
             data.offsetOfDataBufferInShm = totalSize;
             totalSize += sizeof(uint32_t) + metaData.totalDataSize;  // Current length + data buffer
@@ -401,7 +722,7 @@ public:
             _sharedMemory = SharedMemory::CreateOrOpen(name, totalSize);
         }
 
-        for (auto& [signalId, metaData] : _metaDataLookup) {
+        for (auto& metaData : _metaDataVector) {
             const Data& data = _dataVector[metaData.signalIndex];
             DataBuffer* dataBuffer = GetDataBuffer(data.offsetOfDataBufferInShm);
             DataBuffer* backupDataBuffer = GetDataBuffer(data.offsetOfBackupDataBufferInShm);
@@ -424,7 +745,7 @@ protected:
     void ClearDataInternal() override {
         _changedSignalsQueue.Clear();
 
-        for (auto& [signalId, metaData] : _metaDataLookup) {
+        for (auto& metaData : _metaDataVector) {
             Data& data = _dataVector[metaData.signalIndex];
             data.isChanged = false;
 
@@ -445,26 +766,18 @@ protected:
         }
     }
 
-    void WriteInternal(const IoSignalId signalId, const uint32_t length, const void* value) override {
-        MetaData& metaData = FindMetaData(signalId);
+    void ResetChangedBlocksInternal() override {
+        // Both sides access the same shared memory, so there is nothing to resend
+    }
+
+    [[nodiscard]] bool WriteInternal(MetaData& metaData, const uint32_t length, const void* value) override {
         Data& data = _dataVector[metaData.signalIndex];
 
         DataBuffer* dataBuffer = GetDataBuffer(data.offsetOfDataBufferInShm);
 
         bool currentLengthChanged{};
         if (metaData.info.sizeKind == SizeKind::Variable) {
-            if (length > metaData.info.length) {
-                throw CoSimException("Length of variable sized IO signal '" + std::string(metaData.info.name) +
-                                     "' exceeds max size.");
-            }
-
             currentLengthChanged = dataBuffer->currentLength != length;
-        } else {
-            if (length != metaData.info.length) {
-                throw CoSimException("Length of fixed sized IO signal '" + std::string(metaData.info.name) +
-                                     "' must be " + std::to_string(metaData.info.length) + " but was " +
-                                     std::to_string(length) + ".");
-            }
         }
 
         const size_t totalSize = metaData.dataTypeSize * length;
@@ -472,12 +785,12 @@ protected:
         const bool dataChanged = memcmp(dataBuffer->data, value, totalSize) != 0;
 
         if (!currentLengthChanged && !dataChanged) {
-            return;
+            return false;
         }
 
-        if (!data.isChanged) {
+        const bool firstChange = !data.isChanged;
+        if (firstChange) {
             data.isChanged = true;
-            _changedSignalsQueue.PushBack(&metaData);
             FlipBuffers(data);
             dataBuffer = GetDataBuffer(data.offsetOfDataBufferInShm);
         }
@@ -486,10 +799,11 @@ protected:
         if (dataChanged) {
             (void)memcpy(dataBuffer->data, value, totalSize);
         }
+
+        return firstChange;
     }
 
-    void ReadInternal(const IoSignalId signalId, uint32_t& length, void* value) override {
-        const MetaData& metaData = FindMetaData(signalId);
+    void ReadInternal(const MetaData& metaData, uint32_t& length, void* value) override {
         const Data& data = _dataVector[metaData.signalIndex];
 
         const DataBuffer* dataBuffer = GetDataBuffer(data.offsetOfDataBufferInShm);
@@ -499,8 +813,7 @@ protected:
         (void)memcpy(value, dataBuffer->data, totalSize);
     }
 
-    void ReadInternal(const IoSignalId signalId, uint32_t& length, const void** value) override {
-        const MetaData& metaData = FindMetaData(signalId);
+    void ReadInternal(const MetaData& metaData, uint32_t& length, const void** value) override {
         const Data& data = _dataVector[metaData.signalIndex];
 
         const DataBuffer* dataBuffer = GetDataBuffer(data.offsetOfDataBufferInShm);
@@ -585,12 +898,11 @@ private:
     SharedMemory _sharedMemory;
 };
 
-#endif
-
 class IoBufferImpl final : public IoBuffer {
 public:
     IoBufferImpl(CoSimType coSimType,
                  const ConnectionKind connectionKind,
+                 const uint32_t protocolVersion,
                  const std::string& name,
                  const std::vector<IoSignal>& incomingSignals,
                  const std::vector<IoSignal>& outgoingSignals) {
@@ -604,17 +916,23 @@ public:
             readSignals = &outgoingSignals;
         }
 
-#ifdef _WIN32
         if (connectionKind == ConnectionKind::Local) {
             _readBuffer = std::make_unique<LocalIoPartBuffer>(coSimType, incomingName, *readSignals);
             _writeBuffer = std::make_unique<LocalIoPartBuffer>(coSimType, outgoingName, *writeSignals);
         } else {
-#endif
-            _readBuffer = std::make_unique<RemoteIoPartBuffer>(coSimType, incomingName, *readSignals);
-            _writeBuffer = std::make_unique<RemoteIoPartBuffer>(coSimType, outgoingName, *writeSignals);
-#ifdef _WIN32
+            const bool useChangedBlocksEncoding = protocolVersion >= CoSimProtocolVersion1_1;
+            const bool useCompactEncoding = protocolVersion >= CoSimProtocolVersion1_4;
+            _readBuffer = std::make_unique<RemoteIoPartBuffer>(coSimType,
+                                                               incomingName,
+                                                               *readSignals,
+                                                               useChangedBlocksEncoding,
+                                                               useCompactEncoding);
+            _writeBuffer = std::make_unique<RemoteIoPartBuffer>(coSimType,
+                                                                outgoingName,
+                                                                *writeSignals,
+                                                                useChangedBlocksEncoding,
+                                                                useCompactEncoding);
         }
-#endif
 
         ClearData();
     }
@@ -632,6 +950,10 @@ public:
         _writeBuffer->ClearData();
     }
 
+    void ResetChangedBlocks() const override {
+        _writeBuffer->ResetChangedBlocks();
+    }
+
     void Write(const IoSignalId signalId, const uint32_t length, const void* value) const override {
         _writeBuffer->Write(signalId, length, value);
     }
@@ -644,6 +966,34 @@ public:
         _readBuffer->Read(signalId, length, value);
     }
 
+    void WriteSignals(const uint32_t signalsCount, const IoSignalWriteValue* signals) const override {
+        _writeBuffer->WriteSignals(signalsCount, signals);
+    }
+
+    void ReadSignals(const uint32_t signalsCount, IoSignalReadValue* signals) const override {
+        _readBuffer->ReadSignals(signalsCount, signals);
+    }
+
+    [[nodiscard]] IoSignalHandle GetWriteSignalHandle(const IoSignalId signalId) const override {
+        return _writeBuffer->GetHandle(signalId);
+    }
+
+    [[nodiscard]] IoSignalHandle GetReadSignalHandle(const IoSignalId signalId) const override {
+        return _readBuffer->GetHandle(signalId);
+    }
+
+    void WriteFast(const IoSignalHandle signalHandle, const uint32_t length, const void* value) const override {
+        _writeBuffer->WriteFast(signalHandle, length, value);
+    }
+
+    void ReadFast(const IoSignalHandle signalHandle, uint32_t& length, void* value) const override {
+        _readBuffer->ReadFast(signalHandle, length, value);
+    }
+
+    void ReadFast(const IoSignalHandle signalHandle, uint32_t& length, const void** value) const override {
+        _readBuffer->ReadFast(signalHandle, length, value);
+    }
+
     [[nodiscard]] bool Serialize(ChannelWriter& writer) const override {
         return _writeBuffer->Serialize(writer);
     }
@@ -663,10 +1013,16 @@ private:
 
 [[nodiscard]] std::unique_ptr<IoBuffer> CreateIoBuffer(CoSimType coSimType,
                                                        ConnectionKind connectionKind,
+                                                       uint32_t protocolVersion,
                                                        const std::string& name,
                                                        const std::vector<IoSignal>& incomingSignals,
                                                        const std::vector<IoSignal>& outgoingSignals) {
-    return std::make_unique<IoBufferImpl>(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+    return std::make_unique<IoBufferImpl>(coSimType,
+                                          connectionKind,
+                                          protocolVersion,
+                                          name,
+                                          incomingSignals,
+                                          outgoingSignals);
 }
 
 }  // namespace DsVeosCoSim
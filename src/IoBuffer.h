@@ -18,10 +18,23 @@ public:
 
     virtual void ClearData() const = 0;
 
+    // Sends the complete data of the next changed signals, e.g. after the counterpart cleared its data
+    virtual void ResetChangedBlocks() const = 0;
+
     virtual void Write(IoSignalId signalId, uint32_t length, const void* value) const = 0;
     virtual void Read(IoSignalId signalId, uint32_t& length, void* value) const = 0;
     virtual void Read(IoSignalId signalId, uint32_t& length, const void** value) const = 0;
 
+    virtual void WriteSignals(uint32_t signalsCount, const IoSignalWriteValue* signals) const = 0;
+    virtual void ReadSignals(uint32_t signalsCount, IoSignalReadValue* signals) const = 0;
+
+    [[nodiscard]] virtual IoSignalHandle GetWriteSignalHandle(IoSignalId signalId) const = 0;
+    [[nodiscard]] virtual IoSignalHandle GetReadSignalHandle(IoSignalId signalId) const = 0;
+
+    virtual void WriteFast(IoSignalHandle signalHandle, uint32_t length, const void* value) const = 0;
+    virtual void ReadFast(IoSignalHandle signalHandle, uint32_t& length, void* value) const = 0;
+    virtual void ReadFast(IoSignalHandle signalHandle, uint32_t& length, const void** value) const = 0;
+
     [[nodiscard]] virtual bool Serialize(ChannelWriter& writer) const = 0;
     [[nodiscard]] virtual bool Deserialize(ChannelReader& reader,
                                            SimulationTime simulationTime,
@@ -30,6 +43,7 @@ public:
 
 [[nodiscard]] std::unique_ptr<IoBuffer> CreateIoBuffer(CoSimType coSimType,
                                                        ConnectionKind connectionKind,
+                                                       uint32_t protocolVersion,
                                                        const std::string& name,
                                                        const std::vector<IoSignal>& incomingSignals,
                                                        const std::vector<IoSignal>& outgoingSignals);
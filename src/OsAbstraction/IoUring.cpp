@@ -0,0 +1,185 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#ifndef _WIN32
+
+#include "IoUring.h"
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "CoSimHelper.h"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint32_t EntryCount = 2;
+
+[[nodiscard]] int32_t Setup(const uint32_t entryCount, io_uring_params& parameters) {
+    return static_cast<int32_t>(syscall(__NR_io_uring_setup, entryCount, &parameters));
+}
+
+[[nodiscard]] int32_t Enter(const int32_t fileDescriptor,
+                            const uint32_t submitCount,
+                            const uint32_t waitCount,
+                            const uint32_t flags) {
+    return static_cast<int32_t>(
+        syscall(__NR_io_uring_enter, fileDescriptor, submitCount, waitCount, flags, nullptr, size_t{0}));
+}
+
+[[nodiscard]] bool IsReceiveSupported(const int32_t fileDescriptor) {
+    constexpr uint32_t probeCount = IORING_OP_RECV + 1;
+    std::vector<uint8_t> buffer(sizeof(io_uring_probe) + (probeCount * sizeof(io_uring_probe_op)));
+    auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+
+    if (syscall(__NR_io_uring_register, fileDescriptor, IORING_REGISTER_PROBE, probe, probeCount) < 0) {
+        return false;
+    }
+
+    return (probe->last_op >= IORING_OP_RECV) && ((probe->ops[IORING_OP_RECV].flags & IO_URING_OP_SUPPORTED) != 0);
+}
+
+[[nodiscard]] void* Map(const int32_t fileDescriptor, const size_t size, const off_t offset) {
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fileDescriptor, offset);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    return data;
+}
+
+[[nodiscard]] uint32_t* GetField(void* ring, const uint32_t offset) {
+    return reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(ring) + offset);
+}
+
+}  // namespace
+
+IoUring::~IoUring() noexcept {
+    if (_submissionEntries) {
+        (void)munmap(_submissionEntries, _submissionEntriesSize);
+    }
+
+    if (_completionRing && (_completionRing != _submissionRing)) {
+        (void)munmap(_completionRing, _completionRingSize);
+    }
+
+    if (_submissionRing) {
+        (void)munmap(_submissionRing, _submissionRingSize);
+    }
+
+    if (_fileDescriptor >= 0) {
+        (void)close(_fileDescriptor);
+    }
+}
+
+[[nodiscard]] std::unique_ptr<IoUring> IoUring::TryCreate() {
+    io_uring_params parameters{};
+    const int32_t fileDescriptor = Setup(EntryCount, parameters);
+    if (fileDescriptor < 0) {
+        LogTrace("io_uring is not available. " + GetSystemErrorMessage(errno));
+        return {};
+    }
+
+    std::unique_ptr<IoUring> ioUring(new IoUring());
+    ioUring->_fileDescriptor = fileDescriptor;
+
+    if (!IsReceiveSupported(fileDescriptor)) {
+        LogTrace("io_uring does not support receiving from sockets.");
+        return {};
+    }
+
+    ioUring->_submissionRingSize = parameters.sq_off.array + (parameters.sq_entries * sizeof(uint32_t));
+    ioUring->_completionRingSize = parameters.cq_off.cqes + (parameters.cq_entries * sizeof(io_uring_cqe));
+    const bool isSingleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (isSingleMapping) {
+        ioUring->_submissionRingSize = std::max(ioUring->_submissionRingSize, ioUring->_completionRingSize);
+        ioUring->_completionRingSize = ioUring->_submissionRingSize;
+    }
+
+    ioUring->_submissionRing = Map(fileDescriptor, ioUring->_submissionRingSize, IORING_OFF_SQ_RING);
+    if (!ioUring->_submissionRing) {
+        return {};
+    }
+
+    ioUring->_completionRing = isSingleMapping
+                                   ? ioUring->_submissionRing
+                                   : Map(fileDescriptor, ioUring->_completionRingSize, IORING_OFF_CQ_RING);
+    if (!ioUring->_completionRing) {
+        return {};
+    }
+
+    ioUring->_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+    ioUring->_submissionEntries = Map(fileDescriptor, ioUring->_submissionEntriesSize, IORING_OFF_SQES);
+    if (!ioUring->_submissionEntries) {
+        return {};
+    }
+
+    ioUring->_submissionTail = GetField(ioUring->_submissionRing, parameters.sq_off.tail);
+    ioUring->_submissionMask = *GetField(ioUring->_submissionRing, parameters.sq_off.ring_mask);
+    ioUring->_submissionArray = GetField(ioUring->_submissionRing, parameters.sq_off.array);
+    ioUring->_completionHead = GetField(ioUring->_completionRing, parameters.cq_off.head);
+    ioUring->_completionTail = GetField(ioUring->_completionRing, parameters.cq_off.tail);
+    ioUring->_completionMask = *GetField(ioUring->_completionRing, parameters.cq_off.ring_mask);
+    ioUring->_completionEntries = static_cast<uint8_t*>(ioUring->_completionRing) + parameters.cq_off.cqes;
+    return ioUring;
+}
+
+[[nodiscard]] bool IoUring::SubmitReceive(const SocketHandle socket, void* destination, const int32_t size) {
+    const uint32_t tail = *_submissionTail;
+    const uint32_t index = tail & _submissionMask;
+
+    auto& entry = static_cast<io_uring_sqe*>(_submissionEntries)[index];
+    (void)memset(&entry, 0, sizeof(entry));
+    entry.opcode = IORING_OP_RECV;
+    entry.fd = socket;
+    entry.addr = reinterpret_cast<uint64_t>(destination);
+    entry.len = static_cast<uint32_t>(size);
+
+    _submissionArray[index] = index;
+    __atomic_store_n(_submissionTail, tail + 1, __ATOMIC_RELEASE);
+
+    while (true) {
+        const int32_t result = Enter(_fileDescriptor, 1, 0, 0);
+        if (result == 1) {
+            return true;
+        }
+
+        if ((result < 0) && (errno == EINTR)) {
+            continue;
+        }
+
+        LogError("Could not submit receive request. " + GetSystemErrorMessage(errno));
+        return false;
+    }
+}
+
+[[nodiscard]] bool IoUring::HasCompletion() const {
+    return __atomic_load_n(_completionTail, __ATOMIC_ACQUIRE) != *_completionHead;
+}
+
+[[nodiscard]] int32_t IoUring::WaitForCompletion() {
+    while (!HasCompletion()) {
+        if ((Enter(_fileDescriptor, 0, 1, IORING_ENTER_GETEVENTS) < 0) && (errno != EINTR)) {
+            return -errno;
+        }
+    }
+
+    const uint32_t head = *_completionHead;
+    const int32_t result = static_cast<const io_uring_cqe*>(_completionEntries)[head & _completionMask].res;
+    __atomic_store_n(_completionHead, head + 1, __ATOMIC_RELEASE);
+    return result;
+}
+
+}  // namespace DsVeosCoSim
+
+#endif
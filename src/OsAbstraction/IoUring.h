@@ -0,0 +1,57 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Socket.h"
+
+namespace DsVeosCoSim {
+
+// Minimal io_uring with a single request in flight. Completions can be polled in user space without system calls
+class IoUring final {
+    IoUring() = default;
+
+public:
+    ~IoUring() noexcept;
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    IoUring(IoUring&&) = delete;
+    IoUring& operator=(IoUring&&) = delete;
+
+    // Returns an empty pointer if the kernel does not support io_uring receives
+    [[nodiscard]] static std::unique_ptr<IoUring> TryCreate();
+
+    [[nodiscard]] bool SubmitReceive(SocketHandle socket, void* destination, int32_t size);
+    [[nodiscard]] bool HasCompletion() const;
+    // Returns the result of the submitted request, which is a negative error code on failure
+    [[nodiscard]] int32_t WaitForCompletion();
+
+private:
+    int32_t _fileDescriptor = -1;
+
+    void* _submissionRing{};
+    size_t _submissionRingSize{};
+    void* _completionRing{};
+    size_t _completionRingSize{};
+    void* _submissionEntries{};
+    size_t _submissionEntriesSize{};
+
+    uint32_t* _submissionTail{};
+    uint32_t _submissionMask{};
+    uint32_t* _submissionArray{};
+    uint32_t* _completionHead{};
+    uint32_t* _completionTail{};
+    uint32_t _completionMask{};
+    void* _completionEntries{};
+};
+
+}  // namespace DsVeosCoSim
+
+#endif
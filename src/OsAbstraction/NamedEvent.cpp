@@ -1,23 +1,37 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include "NamedEvent.h"
 
-#include <windows.h>  // NOLINT
-
 #include <cstdint>
 #include <optional>
 #include <string>
 #include <utility>
 
+#include "OsUtilities.h"
+
+#ifdef _WIN32
+#include <windows.h>  // NOLINT
+
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "Handle.h"
-#include "OsUtilities.h"
+#else
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#include <time.h>  // NOLINT
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+
+#include "SharedMemory.h"
+#endif
 
 namespace DsVeosCoSim {
 
+#ifdef _WIN32
+
 namespace {
 
 [[nodiscard]] std::wstring GetFullNamedEventName(const std::string& name) {
@@ -78,6 +92,114 @@ void NamedEvent::Wait() const {
     return _handle.Wait(milliseconds);
 }
 
-}  // namespace DsVeosCoSim
+#else
+
+namespace {
+
+// Auto-reset event living in shared memory. The waiter count allows Set to skip the wake-up system call as long as
+// nobody is sleeping on the event.
+struct EventState {
+    std::atomic<uint32_t> isSet;
+    std::atomic<uint32_t> waiterCount;
+};
+
+[[nodiscard]] std::string GetSharedMemoryName(const std::string& name) {
+    return "Event." + name;
+}
+
+[[nodiscard]] EventState& GetEventState(const SharedMemory& sharedMemory) {
+    return *static_cast<EventState*>(sharedMemory.data());
+}
+
+void FutexWait(std::atomic<uint32_t>& address, const uint32_t expectedValue, const timespec* timeout) {
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t*>(&address), FUTEX_WAIT, expectedValue, timeout, nullptr, 0);
+}
+
+void FutexWakeOne(std::atomic<uint32_t>& address) {
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t*>(&address), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+}  // namespace
+
+NamedEvent::NamedEvent(SharedMemory sharedMemory) : _sharedMemory(std::move(sharedMemory)) {
+}
+
+[[nodiscard]] NamedEvent NamedEvent::CreateOrOpen(const std::string& name) {
+    return NamedEvent(SharedMemory::CreateOrOpen(GetSharedMemoryName(name), sizeof(EventState)));
+}
+
+[[nodiscard]] NamedEvent NamedEvent::OpenExisting(const std::string& name) {
+    return NamedEvent(SharedMemory::OpenExisting(GetSharedMemoryName(name), sizeof(EventState)));
+}
+
+[[nodiscard]] std::optional<NamedEvent> NamedEvent::TryOpenExisting(const std::string& name) {
+    std::optional<SharedMemory> sharedMemory = SharedMemory::TryOpenExisting(GetSharedMemoryName(name),
+                                                                             sizeof(EventState));
+    if (!sharedMemory) {
+        return {};
+    }
+
+    return NamedEvent(std::move(*sharedMemory));
+}
+
+void NamedEvent::Set() const {
+    EventState& state = GetEventState(_sharedMemory);
+    if ((state.isSet.exchange(1) == 0) && (state.waiterCount.load() > 0)) {
+        FutexWakeOne(state.isSet);
+    }
+}
+
+void NamedEvent::Wait() const {
+    (void)Wait(Infinite);
+}
+
+[[nodiscard]] bool NamedEvent::Wait(const uint32_t milliseconds) const {
+    EventState& state = GetEventState(_sharedMemory);
+    if (state.isSet.exchange(0) == 1) {
+        return true;
+    }
+
+    if (milliseconds == 0) {
+        return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+
+    state.waiterCount.fetch_add(1);
+
+    bool result{};
+    while (true) {
+        if (state.isSet.exchange(0) == 1) {
+            result = true;
+            break;
+        }
+
+        if (milliseconds == Infinite) {
+            FutexWait(state.isSet, 0, nullptr);
+            continue;
+        }
+
+        const auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::nanoseconds::zero()) {
+            break;
+        }
+
+        const auto remainingNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+        timespec timeout{};
+        timeout.tv_sec = static_cast<time_t>(remainingNanoseconds / 1000000000);
+        timeout.tv_nsec = static_cast<long>(remainingNanoseconds % 1000000000);  // NOLINT
+        FutexWait(state.isSet, 0, &timeout);
+    }
+
+    state.waiterCount.fetch_sub(1);
+    return result;
+}
+
+[[nodiscard]] bool SignalAndWait(const NamedEvent& toSignal, const NamedEvent& toWait, const uint32_t milliseconds) {
+    toSignal.Set();
+    return toWait.Wait(milliseconds);
+}
 
 #endif
+
+}  // namespace DsVeosCoSim
@@ -2,18 +2,24 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstdint>
 #include <optional>
 #include <string>
 
+#ifdef _WIN32
 #include "Handle.h"
+#else
+#include "SharedMemory.h"
+#endif
 
 namespace DsVeosCoSim {
 
 class NamedEvent final {
+#ifdef _WIN32
     NamedEvent(Handle handle, const std::string& name);
+#else
+    explicit NamedEvent(SharedMemory sharedMemory);
+#endif
 
 public:
     NamedEvent() = default;
@@ -29,17 +35,27 @@ public:
     [[nodiscard]] static NamedEvent OpenExisting(const std::string& name);
     [[nodiscard]] static std::optional<NamedEvent> TryOpenExisting(const std::string& name);
 
+#ifdef _WIN32
     operator Handle&() noexcept;  // NOLINT
+#endif
 
     void Set() const;
     void Wait() const;
     [[nodiscard]] bool Wait(uint32_t milliseconds) const;
 
 private:
+#ifdef _WIN32
     Handle _handle;
     std::string _name;
+#else
+    SharedMemory _sharedMemory;
+#endif
 };
 
-}  // namespace DsVeosCoSim
+#ifndef _WIN32
+
+[[nodiscard]] bool SignalAndWait(const NamedEvent& toSignal, const NamedEvent& toWait, uint32_t milliseconds);
 
 #endif
+
+}  // namespace DsVeosCoSim
@@ -1,11 +1,7 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include "NamedMutex.h"
 
-#include <windows.h>  // NOLINT
-
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -13,11 +9,30 @@
 
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
-#include "Handle.h"
 #include "OsUtilities.h"
 
+#ifdef _WIN32
+#include <windows.h>  // NOLINT
+
+#include "Handle.h"
+#else
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#endif
+
 namespace DsVeosCoSim {
 
+#ifdef _WIN32
+
 namespace {
 
 [[nodiscard]] std::wstring GetFullNamedMutexName(const std::string& name) {
@@ -29,6 +44,12 @@ namespace {
 NamedMutex::NamedMutex(Handle handle) : _handle(std::move(handle)) {
 }
 
+NamedMutex::~NamedMutex() noexcept = default;
+
+NamedMutex::NamedMutex(NamedMutex&&) noexcept = default;
+
+NamedMutex& NamedMutex::operator=(NamedMutex&&) noexcept = default;
+
 [[nodiscard]] NamedMutex NamedMutex::CreateOrOpen(const std::string& name) {
     const std::wstring fullName = GetFullNamedMutexName(name);
     void* handle = CreateMutexW(nullptr, FALSE, fullName.c_str());  // NOLINT
@@ -72,6 +93,144 @@ void NamedMutex::unlock() const {  // NOLINT
     (void)ReleaseMutex(_handle);   // NOLINT
 }
 
-}  // namespace DsVeosCoSim
+#else
+
+// The mutex is an advisory lock on a shared memory file, so the kernel releases it if the owner crashes. The owner
+// removes the name on unlock, so no files are left behind. A waiter that acquired the lock on such a removed file
+// detects that and starts over with a fresh one.
+
+namespace {
+
+[[nodiscard]] std::string GetFullNamedMutexName(const std::string& name) {
+    std::string fullName = "/dSPACE.VEOS.CoSim.Mutex." + name;
+
+    // POSIX only allows the leading slash
+    std::replace(fullName.begin() + 1, fullName.end(), '/', '_');
+    return fullName;
+}
+
+}  // namespace
+
+NamedMutex::NamedMutex(std::string fullName, const int32_t fileDescriptor)
+    : _fullName(std::move(fullName)), _fileDescriptor(fileDescriptor) {
+}
+
+NamedMutex::~NamedMutex() noexcept {
+    if (_fileDescriptor < 0) {
+        return;
+    }
+
+    if ((flock(_fileDescriptor, LOCK_EX | LOCK_NB) == 0) && IsStillLinked()) {
+        (void)shm_unlink(_fullName.c_str());
+    }
+
+    (void)close(_fileDescriptor);
+}
+
+NamedMutex::NamedMutex(NamedMutex&& mutex) noexcept
+    : _fullName(std::move(mutex._fullName)), _fileDescriptor(mutex._fileDescriptor) {
+    mutex._fileDescriptor = -1;
+}
+
+NamedMutex& NamedMutex::operator=(NamedMutex&& mutex) noexcept {
+    std::swap(_fullName, mutex._fullName);
+    std::swap(_fileDescriptor, mutex._fileDescriptor);
+    return *this;
+}
+
+[[nodiscard]] NamedMutex NamedMutex::CreateOrOpen(const std::string& name) {
+    std::string fullName = GetFullNamedMutexName(name);
+    const int32_t fileDescriptor = shm_open(fullName.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fileDescriptor < 0) {
+        throw CoSimException("Could not create or open mutex '" + name + "'. " + GetSystemErrorMessage(errno));
+    }
+
+    return {std::move(fullName), fileDescriptor};
+}
+
+[[nodiscard]] NamedMutex NamedMutex::OpenExisting(const std::string& name) {
+    std::string fullName = GetFullNamedMutexName(name);
+    const int32_t fileDescriptor = shm_open(fullName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (fileDescriptor < 0) {
+        throw CoSimException("Could not open mutex '" + name + "'. " + GetSystemErrorMessage(errno));
+    }
+
+    return {std::move(fullName), fileDescriptor};
+}
+
+[[nodiscard]] std::optional<NamedMutex> NamedMutex::TryOpenExisting(const std::string& name) {
+    std::string fullName = GetFullNamedMutexName(name);
+    const int32_t fileDescriptor = shm_open(fullName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (fileDescriptor < 0) {
+        return {};
+    }
+
+    return NamedMutex(std::move(fullName), fileDescriptor);
+}
+
+void NamedMutex::lock() const {  // NOLINT
+    (void)lock(Infinite);
+}
+
+[[nodiscard]] bool NamedMutex::lock(const uint32_t milliseconds) const {  // NOLINT
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+
+    while (true) {
+        if (milliseconds == Infinite) {
+            while (flock(_fileDescriptor, LOCK_EX) != 0) {
+                if (errno != EINTR) {
+                    throw CoSimException("Could not lock mutex. " + GetSystemErrorMessage(errno));
+                }
+            }
+        } else {
+            while (flock(_fileDescriptor, LOCK_EX | LOCK_NB) != 0) {
+                if (errno != EWOULDBLOCK) {
+                    throw CoSimException("Could not lock mutex. " + GetSystemErrorMessage(errno));
+                }
+
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        if (IsStillLinked()) {
+            return true;
+        }
+
+        Reopen();
+    }
+}
+
+void NamedMutex::unlock() const {  // NOLINT
+    (void)shm_unlink(_fullName.c_str());
+    (void)flock(_fileDescriptor, LOCK_UN);
+}
+
+[[nodiscard]] bool NamedMutex::IsStillLinked() const {
+    const int32_t fileDescriptor = shm_open(_fullName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (fileDescriptor < 0) {
+        return false;
+    }
+
+    struct stat linkedStatus {};
+    struct stat ownStatus {};
+    const bool isSameFile = (fstat(fileDescriptor, &linkedStatus) == 0) && (fstat(_fileDescriptor, &ownStatus) == 0) &&
+                            (linkedStatus.st_dev == ownStatus.st_dev) && (linkedStatus.st_ino == ownStatus.st_ino);
+    (void)close(fileDescriptor);
+    return isSameFile;
+}
+
+void NamedMutex::Reopen() const {
+    (void)close(_fileDescriptor);
+    _fileDescriptor = shm_open(_fullName.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (_fileDescriptor < 0) {
+        throw CoSimException("Could not reopen mutex. " + GetSystemErrorMessage(errno));
+    }
+}
 
 #endif
+
+}  // namespace DsVeosCoSim
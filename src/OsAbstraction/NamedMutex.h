@@ -2,28 +2,32 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstdint>
 #include <optional>
 #include <string>
 
+#ifdef _WIN32
 #include "Handle.h"
+#endif
 
 namespace DsVeosCoSim {
 
 class NamedMutex final {
+#ifdef _WIN32
     explicit NamedMutex(Handle handle);
+#else
+    NamedMutex(std::string fullName, int32_t fileDescriptor);
+#endif
 
 public:
     NamedMutex() = default;
-    ~NamedMutex() noexcept = default;
+    ~NamedMutex() noexcept;
 
     NamedMutex(const NamedMutex&) = delete;
     NamedMutex& operator=(const NamedMutex&) = delete;
 
-    NamedMutex(NamedMutex&&) noexcept = default;
-    NamedMutex& operator=(NamedMutex&&) noexcept = default;
+    NamedMutex(NamedMutex&&) noexcept;
+    NamedMutex& operator=(NamedMutex&&) noexcept;
 
     [[nodiscard]] static NamedMutex CreateOrOpen(const std::string& name);
     [[nodiscard]] static NamedMutex OpenExisting(const std::string& name);
@@ -35,9 +39,15 @@ public:
     void unlock() const;                                   // NOLINT
 
 private:
+#ifdef _WIN32
     Handle _handle;
+#else
+    [[nodiscard]] bool IsStillLinked() const;
+    void Reopen() const;
+
+    std::string _fullName;
+    mutable int32_t _fileDescriptor = -1;
+#endif
 };
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -1,17 +1,24 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include "OsUtilities.h"
 
-#include <windows.h>  // NOLINT
-
 #include <cstdint>
 #include <string>
 #include <string_view>
 
+#ifdef _WIN32
+#include <windows.h>  // NOLINT
+#else
+#include <signal.h>  // NOLINT
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
 namespace DsVeosCoSim {
 
+#ifdef _WIN32
+
 [[nodiscard]] std::wstring Utf8ToWide(const std::string_view utf8String) {
     if (utf8String.empty()) {
         return {};
@@ -59,6 +66,21 @@ namespace DsVeosCoSim {
     return (result != 0) && (exitCode == STILL_ACTIVE);
 }
 
-}  // namespace DsVeosCoSim
+#else
+
+[[nodiscard]] uint32_t GetCurrentProcessId() {
+    return static_cast<uint32_t>(getpid());
+}
+
+[[nodiscard]] bool IsProcessRunning(const uint32_t processId) {
+    if (kill(static_cast<pid_t>(processId), 0) == 0) {
+        return true;
+    }
+
+    // The process exists, but belongs to another user
+    return errno == EPERM;
+}
 
 #endif
+
+}  // namespace DsVeosCoSim
@@ -2,8 +2,6 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstdint>
 #include <string>
 #include <string_view>  // IWYU pragma: keep
@@ -12,14 +10,16 @@ namespace DsVeosCoSim {
 
 constexpr uint32_t Infinite = UINT32_MAX;  // NOLINT
 
+#ifdef _WIN32
+
 [[nodiscard]] std::wstring Utf8ToWide(std::string_view utf8String);
 
 [[nodiscard]] int32_t GetLastWindowsError();
 
+#endif
+
 [[nodiscard]] uint32_t GetCurrentProcessId();
 
 [[nodiscard]] bool IsProcessRunning(uint32_t processId);
 
 }  // namespace DsVeosCoSim
-
-#endif
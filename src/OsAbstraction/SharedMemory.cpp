@@ -1,11 +1,7 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include "SharedMemory.h"
 
-#include <windows.h>  // NOLINT
-
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -13,11 +9,29 @@
 
 #include "CoSimHelper.h"
 #include "DsVeosCoSim/CoSimTypes.h"
+
+#ifdef _WIN32
+#include <windows.h>  // NOLINT
+
 #include "Handle.h"
 #include "OsUtilities.h"
+#else
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#endif
 
 namespace DsVeosCoSim {
 
+#ifdef _WIN32
+
 namespace {
 
 [[nodiscard]] std::wstring GetFullSharedMemoryName(const std::string& name) {
@@ -37,6 +51,8 @@ SharedMemory::SharedMemory(const std::string& name, const size_t size, Handle ha
     }
 }
 
+SharedMemory::~SharedMemory() noexcept = default;
+
 SharedMemory::SharedMemory(SharedMemory&& sharedMemory) noexcept
     : _size(sharedMemory._size), _handle(std::move(sharedMemory._handle)), _data(sharedMemory._data) {
     sharedMemory._size = {};
@@ -93,6 +109,182 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& sharedMemory) noexcept {
     return SharedMemory(name, size, handle);
 }
 
+#else
+
+// POSIX shared memory outlives its processes. To get the lifetime of a Windows file mapping, every user holds a shared
+// lock on it and the last one removes the name. The kernel drops the lock of a crashed process, so its memory is
+// reused by the next user.
+
+namespace {
+
+[[nodiscard]] std::string GetFullSharedMemoryName(const std::string& name) {
+    std::string fullName = "/dSPACE.VEOS.CoSim.SharedMemory." + name;
+
+    // POSIX only allows the leading slash
+    std::replace(fullName.begin() + 1, fullName.end(), '/', '_');
+    return fullName;
+}
+
+[[nodiscard]] bool IsStillLinked(const std::string& fullName, const int32_t fileDescriptor) {
+    const int32_t linkedFileDescriptor = shm_open(fullName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    if (linkedFileDescriptor < 0) {
+        return false;
+    }
+
+    struct stat linkedStatus {};
+    struct stat ownStatus {};
+    const bool isSameFile = (fstat(linkedFileDescriptor, &linkedStatus) == 0) &&
+                            (fstat(fileDescriptor, &ownStatus) == 0) && (linkedStatus.st_dev == ownStatus.st_dev) &&
+                            (linkedStatus.st_ino == ownStatus.st_ino);
+    (void)close(linkedFileDescriptor);
+    return isSameFile;
+}
+
+// Returns -1 with errno set, if the shared memory could not be opened
+[[nodiscard]] int32_t OpenAndLock(const std::string& fullName, const int32_t flags) {
+    while (true) {
+        const int32_t fileDescriptor = shm_open(fullName.c_str(), flags, S_IRUSR | S_IWUSR);
+        if (fileDescriptor < 0) {
+            return -1;
+        }
+
+        int32_t result{};
+        do {
+            result = flock(fileDescriptor, LOCK_SH);
+        } while ((result != 0) && (errno == EINTR));
+
+        if (result != 0) {
+            const int32_t errorCode = errno;
+            (void)close(fileDescriptor);
+            errno = errorCode;
+            return -1;
+        }
+
+        // The last user might have removed the name while we were waiting for the lock
+        if (IsStillLinked(fullName, fileDescriptor)) {
+            return fileDescriptor;
+        }
+
+        (void)close(fileDescriptor);
+    }
+}
+
+}  // namespace
+
+SharedMemory::SharedMemory(const std::string& name,
+                           const size_t size,
+                           std::string fullName,
+                           const int32_t fileDescriptor)
+    : _size(size), _fullName(std::move(fullName)), _fileDescriptor(fileDescriptor) {
+    // A second process might open the shared memory before the creator resized it
+    struct stat fileStatus {};
+    bool sizeOk = fstat(_fileDescriptor, &fileStatus) == 0;
+    if (sizeOk && (static_cast<size_t>(fileStatus.st_size) < _size)) {
+        sizeOk = ftruncate(_fileDescriptor, static_cast<off_t>(_size)) == 0;
+    }
+
+    if (sizeOk) {
+        void* data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, _fileDescriptor, 0);
+        if (data != MAP_FAILED) {
+            _data = data;
+        }
+    }
+
+    if (!_data) {
+        const int32_t errorCode = errno;
+        Release();
+        throw CoSimException("Could not map view of shared memory '" + name + "'. " +
+                             GetSystemErrorMessage(errorCode));
+    }
+}
+
+SharedMemory::~SharedMemory() noexcept {
+    Release();
+}
+
+SharedMemory::SharedMemory(SharedMemory&& sharedMemory) noexcept
+    : _size(sharedMemory._size),
+      _fullName(std::move(sharedMemory._fullName)),
+      _fileDescriptor(sharedMemory._fileDescriptor),
+      _data(sharedMemory._data) {
+    sharedMemory._size = {};
+    sharedMemory._fullName.clear();
+    sharedMemory._fileDescriptor = -1;
+    sharedMemory._data = {};
+}
+
+SharedMemory& SharedMemory::operator=(SharedMemory&& sharedMemory) noexcept {
+    if (this == &sharedMemory) {
+        return *this;
+    }
+
+    Release();
+
+    _size = sharedMemory._size;
+    _fullName = std::move(sharedMemory._fullName);
+    _fileDescriptor = sharedMemory._fileDescriptor;
+    _data = sharedMemory._data;
+
+    sharedMemory._size = {};
+    sharedMemory._fullName.clear();
+    sharedMemory._fileDescriptor = -1;
+    sharedMemory._data = {};
+
+    return *this;
+}
+
+[[nodiscard]] SharedMemory SharedMemory::CreateOrOpen(const std::string& name, const size_t size) {
+    std::string fullName = GetFullSharedMemoryName(name);
+    const int32_t fileDescriptor = OpenAndLock(fullName, O_CREAT | O_RDWR);
+    if (fileDescriptor < 0) {
+        throw CoSimException("Could not create or open shared memory '" + name + "'. " +
+                             GetSystemErrorMessage(errno));
+    }
+
+    return {name, size, std::move(fullName), fileDescriptor};
+}
+
+[[nodiscard]] SharedMemory SharedMemory::OpenExisting(const std::string& name, const size_t size) {
+    std::string fullName = GetFullSharedMemoryName(name);
+    const int32_t fileDescriptor = OpenAndLock(fullName, O_RDWR);
+    if (fileDescriptor < 0) {
+        throw CoSimException("Could not open shared memory '" + name + "'. " + GetSystemErrorMessage(errno));
+    }
+
+    return {name, size, std::move(fullName), fileDescriptor};
+}
+
+[[nodiscard]] std::optional<SharedMemory> SharedMemory::TryOpenExisting(const std::string& name, const size_t size) {
+    std::string fullName = GetFullSharedMemoryName(name);
+    const int32_t fileDescriptor = OpenAndLock(fullName, O_RDWR);
+    if (fileDescriptor < 0) {
+        return {};
+    }
+
+    return SharedMemory(name, size, std::move(fullName), fileDescriptor);
+}
+
+void SharedMemory::Release() noexcept {
+    if (_data) {
+        (void)munmap(_data, _size);
+        _data = {};
+    }
+
+    if (_fileDescriptor >= 0) {
+        // Only the last user gets the exclusive lock
+        if ((flock(_fileDescriptor, LOCK_EX | LOCK_NB) == 0) && IsStillLinked(_fullName, _fileDescriptor)) {
+            (void)shm_unlink(_fullName.c_str());
+        }
+
+        (void)close(_fileDescriptor);
+        _fileDescriptor = -1;
+    }
+
+    _fullName.clear();
+}
+
+#endif
+
 [[nodiscard]] void* SharedMemory::data() const noexcept {
     return _data;
 }
@@ -102,5 +294,3 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& sharedMemory) noexcept {
 }
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -2,22 +2,27 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 
+#ifdef _WIN32
 #include "Handle.h"
+#endif
 
 namespace DsVeosCoSim {
 
 class SharedMemory final {
+#ifdef _WIN32
     SharedMemory(const std::string& name, size_t size, Handle handle);
+#else
+    SharedMemory(const std::string& name, size_t size, std::string fullName, int32_t fileDescriptor);
+#endif
 
 public:
     SharedMemory() = default;
-    ~SharedMemory() noexcept = default;
+    ~SharedMemory() noexcept;
 
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory& operator=(const SharedMemory&) = delete;
@@ -34,10 +39,15 @@ public:
 
 private:
     size_t _size{};
+#ifdef _WIN32
     Handle _handle;
+#else
+    void Release() noexcept;
+
+    std::string _fullName;
+    int32_t _fileDescriptor = -1;
+#endif
     void* _data{};
 };
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -3,6 +3,7 @@
 #include "Socket.h"
 
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -57,6 +58,9 @@ typedef struct sockaddr_un
 #include <unistd.h>
 
 #include <cerrno>
+
+#include "IoUring.h"
+#include "SpinWait.h"
 #endif
 
 namespace DsVeosCoSim {
@@ -287,6 +291,69 @@ void SwitchToBlockingMode(const SocketHandle& socket) {
     return false;
 }
 
+void SetOption(const SocketHandle socket,
+               const int32_t level,
+               const int32_t option,
+               int32_t value,
+               const std::string& optionName) {
+    const int32_t result =
+        setsockopt(socket, level, option, reinterpret_cast<char*>(&value), static_cast<SocketLength>(sizeof(value)));
+    if (result != 0) {
+        throw CoSimException("Could not set socket option " + optionName + ". " +
+                             GetSystemErrorMessage(GetLastNetworkError()));
+    }
+}
+
+[[nodiscard]] bool CheckReceivedSize(const int32_t receivedSize) {
+    if (receivedSize > 0) {
+        return true;
+    }
+
+    if (receivedSize == 0) {
+        LogTrace("Remote endpoint disconnected.");
+        return false;
+    }
+
+    int32_t errorCode = GetLastNetworkError();
+
+    if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
+#ifndef _WIN32
+        || (errorCode == ErrorCodeBrokenPipe)
+#endif
+    ) {
+        LogTrace("Remote endpoint disconnected.");
+        return false;
+    }
+
+    LogError("Could not receive from remote endpoint. " + GetSystemErrorMessage(errorCode));
+    return false;
+}
+
+[[nodiscard]] bool CheckSentSize(const int32_t sentSize) {
+    if (sentSize > 0) {
+        return true;
+    }
+
+    if (sentSize == 0) {
+        LogTrace("Remote endpoint disconnected.");
+        return false;
+    }
+
+    int32_t errorCode = GetLastNetworkError();
+
+    if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
+#ifndef _WIN32
+        || (errorCode == ErrorCodeBrokenPipe)
+#endif
+    ) {
+        LogTrace("Remote endpoint disconnected.");
+        return false;
+    }
+
+    LogError("Could not send to remote endpoint. " + GetSystemErrorMessage(errorCode));
+    return false;
+}
+
 }  // namespace
 
 void StartupNetwork() {
@@ -341,13 +408,15 @@ Socket::~Socket() noexcept {
 Socket::Socket(Socket&& other) noexcept {
     Close();
 
-    _socket = other._socket;                // NOLINT
-    _addressFamily = other._addressFamily;  // NOLINT
-    _path = other._path;                    // NOLINT
+    _socket = other._socket;                        // NOLINT
+    _addressFamily = other._addressFamily;          // NOLINT
+    _path = other._path;                            // NOLINT
+    _isQuickAckEnabled = other._isQuickAckEnabled;  // NOLINT
 
     other._socket = InvalidSocket;
     other._addressFamily = {};
     other._path = {};
+    other._isQuickAckEnabled = false;
 }
 
 Socket& Socket::operator=(Socket&& other) noexcept {
@@ -356,10 +425,12 @@ Socket& Socket::operator=(Socket&& other) noexcept {
     _socket = other._socket;
     _addressFamily = other._addressFamily;
     _path = other._path;
+    _isQuickAckEnabled = other._isQuickAckEnabled;
 
     other._socket = InvalidSocket;
     other._addressFamily = {};
     other._path = {};
+    other._isQuickAckEnabled = false;
 
     return *this;
 }
@@ -465,7 +536,8 @@ void Socket::EnableIpv6Only() const {  // NOLINT
 [[nodiscard]] std::optional<Socket> Socket::TryConnect(const std::string_view ipAddress,
                                                        const uint16_t remotePort,
                                                        const uint16_t localPort,
-                                                       const uint32_t timeoutInMilliseconds) {
+                                                       const uint32_t timeoutInMilliseconds,
+                                                       const TcpSocketOptions& socketOptions) {
     if (remotePort == 0) {
         throw CoSimException("Remote port 0 is not valid.");
     }
@@ -486,6 +558,13 @@ void Socket::EnableIpv6Only() const {  // NOLINT
 
         Socket connectedSocket(socket, static_cast<AddressFamily>(addressFamily));
 
+        try {
+            connectedSocket.ApplyOptions(socketOptions);
+        } catch (const CoSimException&) {
+            freeaddrinfo(addressInfo);
+            throw;
+        }
+
         if (localPort != 0) {
             try {
                 connectedSocket.EnableReuseAddress();
@@ -634,6 +713,49 @@ void Socket::EnableNoDelay() const {
     }
 }
 
+void Socket::ApplyOptions(const TcpSocketOptions& socketOptions) {
+    EnsureIsValid();
+
+    if (socketOptions.sendBufferSize > 0) {
+        SetOption(_socket, SOL_SOCKET, SO_SNDBUF, static_cast<int32_t>(socketOptions.sendBufferSize), "send buffer");
+    }
+
+    if (socketOptions.receiveBufferSize > 0) {
+        SetOption(_socket,
+                  SOL_SOCKET,
+                  SO_RCVBUF,
+                  static_cast<int32_t>(socketOptions.receiveBufferSize),
+                  "receive buffer");
+    }
+
+#ifndef _WIN32
+    if (socketOptions.enableQuickAck) {
+        SetOption(_socket, IPPROTO_TCP, TCP_QUICKACK, 1, "quick ack");
+        _isQuickAckEnabled = true;
+    }
+
+    if (socketOptions.busyPollTimeInMicroseconds > 0) {
+        SetOption(_socket,
+                  SOL_SOCKET,
+                  SO_BUSY_POLL,
+                  static_cast<int32_t>(socketOptions.busyPollTimeInMicroseconds),
+                  "busy poll");
+    }
+
+    if (socketOptions.userTimeoutInMilliseconds > 0) {
+        SetOption(_socket,
+                  IPPROTO_TCP,
+                  TCP_USER_TIMEOUT,
+                  static_cast<int32_t>(socketOptions.userTimeoutInMilliseconds),
+                  "user timeout");
+    }
+
+    if (socketOptions.cpuAffinity >= 0) {
+        SetOption(_socket, SOL_SOCKET, SO_INCOMING_CPU, socketOptions.cpuAffinity, "incoming CPU");
+    }
+#endif
+}
+
 void Socket::Listen() const {
     EnsureIsValid();
 
@@ -744,36 +866,48 @@ void Socket::Listen() const {
     return ConvertFromInternetAddress(address);
 }
 
+[[nodiscard]] bool Socket::IsReadable() const {
+    pollfd fdArray{};
+    fdArray.fd = _socket;
+    fdArray.events = POLLIN;
+
+    // Errors and hang-ups count as readable, so the following receive reports them
+    return Poll(&fdArray, 1, 0) != 0;
+}
+
 [[nodiscard]] bool Socket::Receive(void* destination, int32_t size, int32_t& receivedSize) const {
 #ifdef _WIN32
     receivedSize = recv(_socket, static_cast<char*>(destination), size, 0);
 #else
     receivedSize = static_cast<int32_t>(recv(_socket, destination, size, MSG_NOSIGNAL));
-#endif
-
     if (receivedSize > 0) {
-        return true;
-    }
-
-    if (receivedSize == 0) {
-        LogTrace("Remote endpoint disconnected.");
-        return false;
+        RearmQuickAck();
     }
+#endif
 
-    int32_t errorCode = GetLastNetworkError();
+    return CheckReceivedSize(receivedSize);
+}
 
-    if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
 #ifndef _WIN32
-        || (errorCode == ErrorCodeBrokenPipe)
-#endif
-    ) {
-        LogTrace("Remote endpoint disconnected.");
-        return false;
+[[nodiscard]] bool Socket::Receive(IoUring& ioUring,
+                                   void* destination,
+                                   int32_t size,
+                                   int32_t& receivedSize,
+                                   const WaitMode waitMode,
+                                   const std::chrono::microseconds spinTime) const {
+    CheckResult(ioUring.SubmitReceive(_socket, destination, size));
+    (void)SpinWait(waitMode, spinTime, [&] { return ioUring.HasCompletion(); });
+
+    receivedSize = ioUring.WaitForCompletion();
+    if (receivedSize < 0) {
+        errno = -receivedSize;
+    } else if (receivedSize > 0) {
+        RearmQuickAck();
     }
 
-    LogError("Could not receive from remote endpoint. " + GetSystemErrorMessage(errorCode));
-    return false;
+    return CheckReceivedSize(receivedSize);
 }
+#endif
 
 [[nodiscard]] bool Socket::Send(const void* source, int32_t size, int32_t& sentSize) const {
 #ifdef _WIN32
@@ -782,30 +916,54 @@ void Socket::Listen() const {
     sentSize = static_cast<int32_t>(send(_socket, source, size, MSG_NOSIGNAL));
 #endif
 
-    if (sentSize > 0) {
-        return true;
-    }
+    return CheckSentSize(sentSize);
+}
 
-    if (sentSize == 0) {
-        LogTrace("Remote endpoint disconnected.");
-        return false;
+[[nodiscard]] bool Socket::Send(const void* firstSource,
+                                int32_t firstSize,
+                                const void* secondSource,
+                                int32_t secondSize,
+                                int32_t& sentSize) const {
+#ifdef _WIN32
+    std::array<WSABUF, 2> buffers{};
+    buffers[0].buf = static_cast<char*>(const_cast<void*>(firstSource));  // NOLINT
+    buffers[0].len = static_cast<ULONG>(firstSize);
+    buffers[1].buf = static_cast<char*>(const_cast<void*>(secondSource));  // NOLINT
+    buffers[1].len = static_cast<ULONG>(secondSize);
+
+    DWORD bytesSent{};
+    if (WSASend(_socket, buffers.data(), static_cast<DWORD>(buffers.size()), &bytesSent, 0, nullptr, nullptr) != 0) {
+        sentSize = -1;
+    } else {
+        sentSize = static_cast<int32_t>(bytesSent);
     }
+#else
+    std::array<iovec, 2> buffers{};
+    buffers[0].iov_base = const_cast<void*>(firstSource);  // NOLINT
+    buffers[0].iov_len = static_cast<size_t>(firstSize);
+    buffers[1].iov_base = const_cast<void*>(secondSource);  // NOLINT
+    buffers[1].iov_len = static_cast<size_t>(secondSize);
 
-    int32_t errorCode = GetLastNetworkError();
+    msghdr message{};
+    message.msg_iov = buffers.data();
+    message.msg_iovlen = buffers.size();
 
-    if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
-#ifndef _WIN32
-        || (errorCode == ErrorCodeBrokenPipe)
+    sentSize = static_cast<int32_t>(sendmsg(_socket, &message, MSG_NOSIGNAL));
 #endif
-    ) {
-        LogTrace("Remote endpoint disconnected.");
-        return false;
-    }
 
-    LogError("Could not send to remote endpoint. " + GetSystemErrorMessage(errorCode));
-    return false;
+    return CheckSentSize(sentSize);
 }
 
+#ifndef _WIN32
+// The kernel leaves the quick ack mode on its own, so it is entered again after every receive
+void Socket::RearmQuickAck() const {
+    if (_isQuickAckEnabled) {
+        int32_t flags = 1;
+        (void)setsockopt(_socket, IPPROTO_TCP, TCP_QUICKACK, &flags, static_cast<SocketLength>(sizeof(flags)));
+    }
+}
+#endif
+
 void Socket::EnsureIsValid() const {
     if (!IsValid()) {
         throw CoSimException("Socket is not valid.");
@@ -2,13 +2,20 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>  // IWYU pragma: keep
 
+#include "DsVeosCoSim/CoSimTypes.h"
+
 namespace DsVeosCoSim {
 
+#ifndef _WIN32
+class IoUring;
+#endif
+
 void StartupNetwork();
 
 enum class AddressFamily {
@@ -72,7 +79,8 @@ public:
     [[nodiscard]] static std::optional<Socket> TryConnect(std::string_view ipAddress,
                                                           uint16_t remotePort,
                                                           uint16_t localPort,
-                                                          uint32_t timeoutInMilliseconds);
+                                                          uint32_t timeoutInMilliseconds,
+                                                          const TcpSocketOptions& socketOptions = {});
 
     [[nodiscard]] bool TryConnect(const std::string& name) const;
     void EnableIpv6Only() const;
@@ -80,12 +88,30 @@ public:
     void Bind(const std::string& name);
     void EnableReuseAddress() const;
     void EnableNoDelay() const;
+    // Buffer sizes only affect the TCP window scaling if they are set before connecting or listening
+    void ApplyOptions(const TcpSocketOptions& socketOptions);
     void Listen() const;
     [[nodiscard]] std::optional<Socket> TryAccept(uint32_t timeoutInMilliseconds = 0) const;
     [[nodiscard]] uint16_t GetLocalPort() const;
     [[nodiscard]] SocketAddress GetRemoteAddress() const;
+    [[nodiscard]] bool IsReadable() const;
     [[nodiscard]] bool Receive(void* destination, int32_t size, int32_t& receivedSize) const;
+#ifndef _WIN32
+    // Receives through the io_uring, so the wait mode can spin on the completion without system calls
+    [[nodiscard]] bool Receive(IoUring& ioUring,
+                               void* destination,
+                               int32_t size,
+                               int32_t& receivedSize,
+                               WaitMode waitMode,
+                               std::chrono::microseconds spinTime) const;
+#endif
     [[nodiscard]] bool Send(const void* source, int32_t size, int32_t& sentSize) const;
+    // Sends both buffers with one system call, which might send only a part of them
+    [[nodiscard]] bool Send(const void* firstSource,
+                            int32_t firstSize,
+                            const void* secondSource,
+                            int32_t secondSize,
+                            int32_t& sentSize) const;
 
 private:
     void BindForIpv4(uint16_t port, bool enableRemoteAccess) const;
@@ -97,11 +123,16 @@ private:
     [[nodiscard]] SocketAddress GetRemoteAddressForIpv4() const;
     [[nodiscard]] SocketAddress GetRemoteAddressForIpv6() const;
 
+#ifndef _WIN32
+    void RearmQuickAck() const;
+#endif
+
     void EnsureIsValid() const;
 
     SocketHandle _socket = InvalidSocket;
     AddressFamily _addressFamily{};
     std::string _path;
+    bool _isQuickAckEnabled{};
 };
 
 }  // namespace DsVeosCoSim
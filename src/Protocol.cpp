@@ -598,27 +598,35 @@ namespace Protocol {
     return true;
 }
 
-[[nodiscard]] bool SendStep(ChannelWriter& writer,
-                            const SimulationTime simulationTime,
-                            const IoBuffer& ioBuffer,
-                            const BusBuffer& busBuffer) {
+[[nodiscard]] bool WriteStep(ChannelWriter& writer,
+                             const SimulationTime simulationTime,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer) {
     if (IsProtocolTracingEnabled()) {
-        LogProtocolBeginTrace("SendStep(SimulationTime: " + SimulationTimeToString(simulationTime) + " s)");
+        LogProtocolBeginTrace("WriteStep(SimulationTime: " + SimulationTimeToString(simulationTime) + " s)");
     }
 
     CheckResult(WriteHeader(writer, FrameKind::Step));
     CheckResultWithMessage(writer.Write(simulationTime), "Could not write simulation time.");
     CheckResultWithMessage(ioBuffer.Serialize(writer), "Could not write IO buffer data.");
-    CheckResultWithMessage(busBuffer.Serialize(writer), "Could not write bus buffer data.");
-    CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+    CheckResultWithMessage(busBuffer.Serialize(writer, simulationTime), "Could not write bus buffer data.");
 
     if (IsProtocolTracingEnabled()) {
-        LogProtocolEndTrace("SendStep()");
+        LogProtocolEndTrace("WriteStep()");
     }
 
     return true;
 }
 
+[[nodiscard]] bool SendStep(ChannelWriter& writer,
+                            const SimulationTime simulationTime,
+                            const IoBuffer& ioBuffer,
+                            const BusBuffer& busBuffer) {
+    CheckResult(WriteStep(writer, simulationTime, ioBuffer, busBuffer));
+    CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+    return true;
+}
+
 [[nodiscard]] bool ReadStep(ChannelReader& reader,
                             SimulationTime& simulationTime,
                             const IoBuffer& ioBuffer,
@@ -635,7 +643,8 @@ namespace Protocol {
     }
 
     CheckResultWithMessage(ioBuffer.Deserialize(reader, simulationTime, callbacks), "Could not read IO buffer data.");
-    CheckResultWithMessage(busBuffer.Deserialize(reader, simulationTime, callbacks), "Could not read bus buffer data.");
+    CheckResultWithMessage(busBuffer.Deserialize(reader, simulationTime, simulationTime, callbacks),
+                           "Could not read bus buffer data.");
 
     if (IsProtocolTracingEnabled()) {
         LogProtocolEndTrace("ReadStep(SimulationTime: " + SimulationTimeToString(simulationTime) + " s)");
@@ -644,13 +653,76 @@ namespace Protocol {
     return true;
 }
 
-[[nodiscard]] bool SendStepOk(ChannelWriter& writer,
-                              const SimulationTime nextSimulationTime,
-                              const Command command,
+[[nodiscard]] bool WriteStepN(ChannelWriter& writer,
+                              const SimulationTime simulationTime,
+                              const uint32_t stepCount,
                               const IoBuffer& ioBuffer,
                               const BusBuffer& busBuffer) {
     if (IsProtocolTracingEnabled()) {
-        LogProtocolBeginTrace("SendStepOk(NextSimulationTime: " + SimulationTimeToString(nextSimulationTime) +
+        LogProtocolBeginTrace("WriteStepN(SimulationTime: " + SimulationTimeToString(simulationTime) +
+                              " s, StepCount: " + std::to_string(stepCount) + ")");
+    }
+
+    CheckResult(WriteHeader(writer, FrameKind::StepN));
+    CheckResultWithMessage(writer.Write(simulationTime), "Could not write simulation time.");
+    CheckResultWithMessage(writer.Write(stepCount), "Could not write step count.");
+    CheckResultWithMessage(ioBuffer.Serialize(writer), "Could not write IO buffer data.");
+    CheckResultWithMessage(busBuffer.Serialize(writer, simulationTime), "Could not write bus buffer data.");
+
+    if (IsProtocolTracingEnabled()) {
+        LogProtocolEndTrace("WriteStepN()");
+    }
+
+    return true;
+}
+
+[[nodiscard]] bool SendStepN(ChannelWriter& writer,
+                             const SimulationTime simulationTime,
+                             const uint32_t stepCount,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer) {
+    CheckResult(WriteStepN(writer, simulationTime, stepCount, ioBuffer, busBuffer));
+    CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+    return true;
+}
+
+[[nodiscard]] bool ReadStepN(ChannelReader& reader,
+                             SimulationTime& simulationTime,
+                             uint32_t& stepCount,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer,
+                             const Callbacks& callbacks) {
+    if (IsProtocolTracingEnabled()) {
+        LogProtocolBeginTrace("ReadStepN()");
+    }
+
+    CheckResultWithMessage(reader.Read(simulationTime), "Could not read simulation time.");
+    CheckResultWithMessage(reader.Read(stepCount), "Could not read step count.");
+
+    if (callbacks.simulationBeginStepCallback) {
+        callbacks.simulationBeginStepCallback(simulationTime);
+    }
+
+    CheckResultWithMessage(ioBuffer.Deserialize(reader, simulationTime, callbacks), "Could not read IO buffer data.");
+    CheckResultWithMessage(busBuffer.Deserialize(reader, simulationTime, simulationTime, callbacks),
+                           "Could not read bus buffer data.");
+
+    if (IsProtocolTracingEnabled()) {
+        LogProtocolEndTrace("ReadStepN(SimulationTime: " + SimulationTimeToString(simulationTime) +
+                            " s, StepCount: " + std::to_string(stepCount) + ")");
+    }
+
+    return true;
+}
+
+[[nodiscard]] bool WriteStepOk(ChannelWriter& writer,
+                               const SimulationTime stepSimulationTime,
+                               const SimulationTime nextSimulationTime,
+                               const Command command,
+                               const IoBuffer& ioBuffer,
+                               const BusBuffer& busBuffer) {
+    if (IsProtocolTracingEnabled()) {
+        LogProtocolBeginTrace("WriteStepOk(NextSimulationTime: " + SimulationTimeToString(nextSimulationTime) +
                               " s, Command: " + ToString(command) + ")");
     }
 
@@ -658,17 +730,28 @@ namespace Protocol {
     CheckResultWithMessage(writer.Write(nextSimulationTime), "Could not write simulation time.");
     CheckResultWithMessage(writer.Write(command), "Could not write command.");
     CheckResultWithMessage(ioBuffer.Serialize(writer), "Could not write IO buffer data.");
-    CheckResultWithMessage(busBuffer.Serialize(writer), "Could not write bus buffer data.");
-    CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+    CheckResultWithMessage(busBuffer.Serialize(writer, stepSimulationTime), "Could not write bus buffer data.");
 
     if (IsProtocolTracingEnabled()) {
-        LogProtocolEndTrace("SendStepOk()");
+        LogProtocolEndTrace("WriteStepOk()");
     }
 
     return true;
 }
 
+[[nodiscard]] bool SendStepOk(ChannelWriter& writer,
+                              const SimulationTime stepSimulationTime,
+                              const SimulationTime nextSimulationTime,
+                              const Command command,
+                              const IoBuffer& ioBuffer,
+                              const BusBuffer& busBuffer) {
+    CheckResult(WriteStepOk(writer, stepSimulationTime, nextSimulationTime, command, ioBuffer, busBuffer));
+    CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+    return true;
+}
+
 [[nodiscard]] bool ReadStepOk(ChannelReader& reader,
+                              const SimulationTime stepSimulationTime,
                               SimulationTime& nextSimulationTime,
                               Command& command,
                               const IoBuffer& ioBuffer,
@@ -687,7 +770,7 @@ namespace Protocol {
 
     CheckResultWithMessage(ioBuffer.Deserialize(reader, nextSimulationTime, callbacks),
                            "Could not read IO buffer data.");
-    CheckResultWithMessage(busBuffer.Deserialize(reader, nextSimulationTime, callbacks),
+    CheckResultWithMessage(busBuffer.Deserialize(reader, nextSimulationTime, stepSimulationTime, callbacks),
                            "Could not read bus buffer data.");
 
     if (IsProtocolTracingEnabled()) {
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <string>
 
@@ -12,7 +13,26 @@
 
 namespace DsVeosCoSim {
 
-constexpr uint32_t CoSimProtocolVersion = 0x10000U;  // NOLINT
+constexpr uint32_t CoSimProtocolVersion1_0 = 0x10000U;  // NOLINT
+
+// Sends only the changed blocks of large remote IO signals
+constexpr uint32_t CoSimProtocolVersion1_1 = 0x10001U;  // NOLINT
+
+// Names the local IO and bus buffers after the local channel, so a server can host multiple local clients
+constexpr uint32_t CoSimProtocolVersion1_2 = 0x10002U;  // NOLINT
+
+// Socket channels send large payloads in frames larger than 64 KB
+constexpr uint32_t CoSimProtocolVersion1_3 = 0x10003U;  // NOLINT
+
+// Remote IO and bus data in the step frames use varints, signal and controller indices and relative timestamps
+constexpr uint32_t CoSimProtocolVersion1_4 = 0x10004U;  // NOLINT
+
+constexpr uint32_t CoSimProtocolVersion = CoSimProtocolVersion1_4;  // NOLINT
+
+// Both sides use the highest protocol version that both of them support
+[[nodiscard]] inline uint32_t NegotiateProtocolVersion(const uint32_t counterpartProtocolVersion) {
+    return std::min(counterpartProtocolVersion, CoSimProtocolVersion);
+}
 
 enum class FrameKind {
     Ok = 1,
@@ -36,7 +56,9 @@ enum class FrameKind {
     GetPort,
     GetPortOk,
     SetPort,
-    UnsetPort
+    UnsetPort,
+
+    StepN
 };
 
 [[nodiscard]] inline std::string ToString(const FrameKind& frameKind) {
@@ -75,6 +97,8 @@ enum class FrameKind {
             return "SetPort";
         case FrameKind::UnsetPort:
             return "UnsetPort";
+        case FrameKind::StepN:
+            return "StepN";
     }
 
     return "<Invalid FrameKind>";
@@ -141,6 +165,11 @@ namespace Protocol {
 [[nodiscard]] bool SendContinue(ChannelWriter& writer, SimulationTime simulationTime);
 [[nodiscard]] bool ReadContinue(ChannelReader& reader, SimulationTime& simulationTime);
 
+// The write functions leave the frame open, so sending it with EndWrite can be measured separately
+[[nodiscard]] bool WriteStep(ChannelWriter& writer,
+                             SimulationTime simulationTime,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer);
 [[nodiscard]] bool SendStep(ChannelWriter& writer,
                             SimulationTime simulationTime,
                             const IoBuffer& ioBuffer,
@@ -151,12 +180,38 @@ namespace Protocol {
                             const BusBuffer& busBuffer,
                             const Callbacks& callbacks);
 
+[[nodiscard]] bool WriteStepN(ChannelWriter& writer,
+                              SimulationTime simulationTime,
+                              uint32_t stepCount,
+                              const IoBuffer& ioBuffer,
+                              const BusBuffer& busBuffer);
+[[nodiscard]] bool SendStepN(ChannelWriter& writer,
+                             SimulationTime simulationTime,
+                             uint32_t stepCount,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer);
+[[nodiscard]] bool ReadStepN(ChannelReader& reader,
+                             SimulationTime& simulationTime,
+                             uint32_t& stepCount,
+                             const IoBuffer& ioBuffer,
+                             const BusBuffer& busBuffer,
+                             const Callbacks& callbacks);
+
+// The bus timestamps are encoded relative to the simulation time of the step or step n frame being answered
+[[nodiscard]] bool WriteStepOk(ChannelWriter& writer,
+                               SimulationTime stepSimulationTime,
+                               SimulationTime nextSimulationTime,
+                               Command command,
+                               const IoBuffer& ioBuffer,
+                               const BusBuffer& busBuffer);
 [[nodiscard]] bool SendStepOk(ChannelWriter& writer,
+                              SimulationTime stepSimulationTime,
                               SimulationTime nextSimulationTime,
                               Command command,
                               const IoBuffer& ioBuffer,
                               const BusBuffer& busBuffer);
 [[nodiscard]] bool ReadStepOk(ChannelReader& reader,
+                              SimulationTime stepSimulationTime,
                               SimulationTime& nextSimulationTime,
                               Command& command,
                               const IoBuffer& ioBuffer,
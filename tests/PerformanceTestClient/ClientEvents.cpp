@@ -1,6 +1,5 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
 #include <array>
 #include <cstdint>
 #include <string_view>  // IWYU pragma: keep
@@ -51,7 +50,3 @@ void RunEventsTest() {  // NOLINT
     RunPerformanceTest(EventsClientRun, "");
     LogTrace("");
 }
-#else
-void RunEventsTest() {
-}
-#endif
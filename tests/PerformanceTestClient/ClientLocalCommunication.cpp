@@ -19,11 +19,7 @@ void LocalCommunicationClientRun([[maybe_unused]] std::string_view host,
                                  uint64_t& counter,
                                  const bool& isStopped) {
     try {
-#ifdef _WIN32
         std::unique_ptr<Channel> channel = ConnectToLocalChannel(LocalName);
-#else
-        std::unique_ptr<Channel> channel = ConnectToUdsChannel(LocalName);
-#endif
 
         std::array<char, BufferSize> buffer{};
 
@@ -1,6 +1,5 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
 #include <array>
 #include <thread>
 
@@ -40,7 +39,3 @@ void EventsServerRun() {
 void StartEventsServer() {  // NOLINT
     std::thread(EventsServerRun).detach();
 }
-#else
-void StartEventsServer() {  // NOLINT
-}
-#endif
@@ -17,11 +17,7 @@ void LocalCommunicationServerRun() {
     try {
         LogTrace("Local communication server is listening ...");
 
-#ifdef _WIN32
         std::unique_ptr<ChannelServer> server = CreateLocalChannelServer(LocalName);
-#else
-        std::unique_ptr<ChannelServer> server = CreateUdsChannelServer(LocalName);
-#endif
 
         std::array<char, BufferSize> buffer{};
 
@@ -122,8 +122,6 @@ namespace {
     throw std::runtime_error("Could not connect.");
 }
 
-#ifdef _WIN32
-
 [[nodiscard]] std::unique_ptr<Channel> ConnectToLocalChannel(const std::string& name) {
     std::unique_ptr<Channel> channel = TryConnectToLocalChannel(name);
     if (channel) {
@@ -133,8 +131,6 @@ namespace {
     throw std::runtime_error("Could not connect.");
 }
 
-#endif
-
 [[nodiscard]] std::unique_ptr<Channel> Accept(ChannelServer& server) {
     std::unique_ptr<Channel> acceptedChannel = server.TryAccept(DefaultTimeout);
     if (acceptedChannel) {
@@ -37,12 +37,8 @@ constexpr uint32_t DefaultTimeout = 1000;  // NOLINT
                                                                         uint16_t remotePort);
 [[nodiscard]] std::unique_ptr<DsVeosCoSim::Channel> ConnectToUdsChannel(const std::string& name);
 
-#ifdef _WIN32
-
 [[nodiscard]] std::unique_ptr<DsVeosCoSim::Channel> ConnectToLocalChannel(const std::string& name);
 
-#endif
-
 [[nodiscard]] std::unique_ptr<DsVeosCoSim::Channel> Accept(DsVeosCoSim::ChannelServer& server);
 
 [[nodiscard]] std::string_view GetLoopBackAddress(DsVeosCoSim::AddressFamily addressFamily);
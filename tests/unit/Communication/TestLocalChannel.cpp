@@ -1,15 +1,15 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include <gtest/gtest.h>
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Generator.h"
 #include "Helper.h"
@@ -147,6 +147,74 @@ TEST_F(TestLocalChannel, ReadFromChannel) {
     ASSERT_EQ(sendValue, receiveValue);
 }
 
+TEST_F(TestLocalChannel, ReadViewFromChannel) {
+    // Arrange
+    const std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateLocalChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToLocalChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    const uint32_t sendValue = GenerateU32();
+
+    EXPECT_TRUE(connectedChannel->GetWriter().Write(sendValue));
+    EXPECT_TRUE(connectedChannel->GetWriter().EndWrite());
+
+    const uint8_t* view{};
+
+    // Act
+    ASSERT_TRUE(acceptedChannel->GetReader().ReadView(sizeof(sendValue), view));
+
+    // Assert
+    uint32_t receiveValue{};
+    (void)memcpy(&receiveValue, view, sizeof(receiveValue));
+    ASSERT_EQ(sendValue, receiveValue);
+}
+
+TEST_F(TestLocalChannel, ReadVarintsFromChannel) {
+    // Arrange
+    const std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateLocalChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToLocalChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    const std::vector<uint64_t> sendValues = {0, 127, 128, 300, GenerateU32(), UINT64_MAX};
+
+    for (const uint64_t sendValue : sendValues) {
+        EXPECT_TRUE(connectedChannel->GetWriter().WriteVarint(sendValue));
+    }
+
+    EXPECT_TRUE(connectedChannel->GetWriter().EndWrite());
+
+    // Act and assert
+    for (const uint64_t sendValue : sendValues) {
+        uint64_t receiveValue{};
+        ASSERT_TRUE(acceptedChannel->GetReader().ReadVarint(receiveValue));
+        ASSERT_EQ(sendValue, receiveValue);
+    }
+}
+
+TEST_F(TestLocalChannel, ReadVarintExceedingValueRange) {
+    // Arrange
+    const std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateLocalChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToLocalChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    EXPECT_TRUE(connectedChannel->GetWriter().WriteVarint(static_cast<uint64_t>(UINT32_MAX) + 1));
+    EXPECT_TRUE(connectedChannel->GetWriter().EndWrite());
+
+    uint32_t receiveValue{};
+
+    // Act and assert
+    ASSERT_THROW((void)acceptedChannel->GetReader().ReadVarint(receiveValue), CoSimException);
+}
+
 TEST_F(TestLocalChannel, PingPong) {
     // Arrange
     const std::string name = GenerateName();
@@ -268,5 +336,3 @@ TEST_F(TestLocalChannel, SendAndReceiveBigElement) {
 }
 
 }  // namespace
-
-#endif
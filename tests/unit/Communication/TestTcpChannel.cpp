@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -14,6 +15,7 @@
 #include "Generator.h"
 #include "Helper.h"
 #include "Socket.h"
+#include "TestHelper.h"
 
 using namespace DsVeosCoSim;
 
@@ -366,4 +368,232 @@ TEST_P(TestTcpChannel, SendAndReceiveBigElement) {
     thread.join();
 }
 
+void ReceiveBigElementBetweenSmallElements(Channel& channel) {
+    uint32_t receiveValue{};
+    ASSERT_TRUE(channel.GetReader().Read(receiveValue));
+    ASSERT_EQ(42U, receiveValue);
+
+    ReceiveBigElement(channel);
+
+    ASSERT_TRUE(channel.GetReader().Read(receiveValue));
+    ASSERT_EQ(43U, receiveValue);
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveBigElementBetweenSmallElements) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveBigElementBetweenSmallElementsWithLargeFrames) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    acceptedChannel->EnableLargeFrames();
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveBigElementBetweenSmallElementsWithCompression) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    acceptedChannel->EnableLargeFrames();
+    acceptedChannel->EnableCompression();
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+[[nodiscard]] std::vector<uint8_t> CreateCompressibleData(const size_t size, const uint8_t seed) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>((i % 7) + seed);
+    }
+
+    return data;
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveCompressedFrames) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    acceptedChannel->EnableCompression();
+
+    constexpr uint8_t frameCount = 3;
+    const std::vector<uint8_t> randomData = GenerateBytes(10000);
+
+    std::thread thread([&] {
+        for (uint8_t frame = 0; frame < frameCount; frame++) {
+            const std::vector<uint8_t> expectedData = CreateCompressibleData(30000, frame);
+
+            uint32_t receiveValue{};
+            ASSERT_TRUE(connectedChannel->GetReader().Read(receiveValue));
+            ASSERT_EQ(42U, receiveValue);
+
+            const uint8_t* view{};
+            ASSERT_TRUE(connectedChannel->GetReader().ReadView(expectedData.size(), view));
+            AssertByteArray(expectedData.data(), view, expectedData.size());
+
+            std::vector<uint8_t> receivedData(randomData.size());
+            ASSERT_TRUE(connectedChannel->GetReader().Read(receivedData.data(), receivedData.size()));
+            AssertByteArray(randomData.data(), receivedData.data(), randomData.size());
+
+            ASSERT_TRUE(connectedChannel->GetReader().Read(receiveValue));
+            ASSERT_EQ(43U, receiveValue);
+        }
+    });
+
+    // Act and assert
+    for (uint8_t frame = 0; frame < frameCount; frame++) {
+        const std::vector<uint8_t> sendData = CreateCompressibleData(30000, frame);
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendData.data(), sendData.size()));
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(randomData.data(), randomData.size()));
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+        ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+    }
+
+    thread.join();
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveBigElementBetweenSmallElementsWithSpinningReader) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    connectedChannel->SetWaitMode(WaitMode::SpinThenBlock, std::chrono::microseconds(100));
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+constexpr std::array<size_t, 4> ViewSizes = {7, 50000, 100000, 3};
+
+[[nodiscard]] std::vector<uint8_t> CreateViewData(const size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>((i * 7) + size);
+    }
+
+    return data;
+}
+
+void ReceiveViews(Channel& channel) {
+    for (const size_t size : ViewSizes) {
+        const uint8_t* view{};
+        ASSERT_TRUE(channel.GetReader().ReadView(size, view));
+        ASSERT_EQ(CreateViewData(size), std::vector<uint8_t>(view, view + size));
+    }
+}
+
+TEST_P(TestTcpChannel, ReadViews) {
+    // Arrange
+    const Param param = GetParam();
+    const std::string_view ipAddress = GetLoopBackAddress(param.addressFamily);
+
+    const std::unique_ptr<ChannelServer> server = CreateTcpChannelServer(0, true);
+    const uint16_t port = server->GetLocalPort();
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToTcpChannel(ipAddress, port);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    std::thread thread(ReceiveViews, std::ref(*connectedChannel));
+
+    // Act and assert
+    for (const size_t size : ViewSizes) {
+        const std::vector<uint8_t> sendData = CreateViewData(size);
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendData.data(), sendData.size()));
+    }
+
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
 }  // namespace
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Channel.h"
 #include "Generator.h"
@@ -266,4 +267,108 @@ TEST_F(TestUdsChannel, SendAndReceiveBigElement) {
     thread.join();
 }
 
+void ReceiveBigElementBetweenSmallElements(Channel& channel) {
+    uint32_t receiveValue{};
+    ASSERT_TRUE(channel.GetReader().Read(receiveValue));
+    ASSERT_EQ(42U, receiveValue);
+
+    ReceiveBigElement(channel);
+
+    ASSERT_TRUE(channel.GetReader().Read(receiveValue));
+    ASSERT_EQ(43U, receiveValue);
+}
+
+TEST_F(TestUdsChannel, SendAndReceiveBigElementBetweenSmallElements) {
+    // Arrange
+    std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateUdsChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToUdsChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+TEST_F(TestUdsChannel, SendAndReceiveBigElementBetweenSmallElementsWithLargeFrames) {
+    // Arrange
+    std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateUdsChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToUdsChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    acceptedChannel->EnableLargeFrames();
+
+    std::thread thread(ReceiveBigElementBetweenSmallElements, std::ref(*connectedChannel));
+
+    const auto sendArray = std::make_unique<std::array<uint32_t, BigNumber>>();
+    for (size_t i = 0; i < sendArray->size(); i++) {
+        (*sendArray)[i] = static_cast<uint32_t>(i);
+    }
+
+    // Act and assert
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(42U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendArray.get(), sendArray->size() * 4));
+    ASSERT_TRUE(acceptedChannel->GetWriter().Write(43U));
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
+constexpr std::array<size_t, 4> ViewSizes = {7, 50000, 100000, 3};
+
+[[nodiscard]] std::vector<uint8_t> CreateViewData(const size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>((i * 7) + size);
+    }
+
+    return data;
+}
+
+void ReceiveViews(Channel& channel) {
+    for (const size_t size : ViewSizes) {
+        const uint8_t* view{};
+        ASSERT_TRUE(channel.GetReader().ReadView(size, view));
+        ASSERT_EQ(CreateViewData(size), std::vector<uint8_t>(view, view + size));
+    }
+}
+
+TEST_F(TestUdsChannel, ReadViews) {
+    // Arrange
+    std::string name = GenerateName();
+
+    const std::unique_ptr<ChannelServer> server = CreateUdsChannelServer(name);
+
+    const std::unique_ptr<Channel> connectedChannel = ConnectToUdsChannel(name);
+    const std::unique_ptr<Channel> acceptedChannel = Accept(*server);
+
+    std::thread thread(ReceiveViews, std::ref(*connectedChannel));
+
+    // Act and assert
+    for (const size_t size : ViewSizes) {
+        const std::vector<uint8_t> sendData = CreateViewData(size);
+        ASSERT_TRUE(acceptedChannel->GetWriter().Write(sendData.data(), sendData.size()));
+    }
+
+    ASSERT_TRUE(acceptedChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
 }  // namespace
@@ -0,0 +1,123 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Compression.h"
+#include "Generator.h"
+#include "TestHelper.h"
+
+using namespace DsVeosCoSim;
+
+namespace {
+
+class TestCompression : public testing::Test {};
+
+[[nodiscard]] std::vector<uint8_t> CompressData(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> compressedData(GetMaxCompressedSize(data.size()));
+    const size_t compressedSize = Compress(data.data(), data.size(), compressedData.data());
+    compressedData.resize(compressedSize);
+    return compressedData;
+}
+
+void AssertRoundTrip(const std::vector<uint8_t>& data) {
+    const std::vector<uint8_t> compressedData = CompressData(data);
+
+    std::vector<uint8_t> decompressedData(data.size());
+    ASSERT_TRUE(Decompress(compressedData.data(), compressedData.size(), decompressedData.data(), data.size()));
+    AssertByteArray(data.data(), decompressedData.data(), data.size());
+}
+
+TEST_F(TestCompression, RoundTripEmptyData) {
+    // Act and assert
+    AssertRoundTrip({});
+}
+
+TEST_F(TestCompression, RoundTripSmallData) {
+    // Act and assert
+    AssertRoundTrip(GenerateBytes(11));
+}
+
+TEST_F(TestCompression, RoundTripRandomData) {
+    // Act and assert
+    AssertRoundTrip(GenerateBytes(100000));
+}
+
+TEST_F(TestCompression, RoundTripRepeatedData) {
+    // Arrange
+    std::vector<uint8_t> data(200000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i % 3);
+    }
+
+    // Act and assert
+    AssertRoundTrip(data);
+}
+
+TEST_F(TestCompression, RoundTripMixedData) {
+    // Arrange
+    std::vector<uint8_t> data = GenerateBytes(70000);
+    const std::vector<uint8_t> repeatedPart(data.begin(), data.begin() + 1000);
+    for (size_t i = 0; i < 50; i++) {
+        data.insert(data.end(), repeatedPart.begin(), repeatedPart.end());
+    }
+
+    // Act and assert
+    AssertRoundTrip(data);
+}
+
+TEST_F(TestCompression, CompressRepeatedData) {
+    // Arrange
+    const std::vector<uint8_t> data(100000, GenerateU8());
+
+    // Act
+    const std::vector<uint8_t> compressedData = CompressData(data);
+
+    // Assert
+    ASSERT_LT(compressedData.size(), data.size() / 100);
+}
+
+TEST_F(TestCompression, DecompressWithWrongSize) {
+    // Arrange
+    const std::vector<uint8_t> data(1000, GenerateU8());
+    const std::vector<uint8_t> compressedData = CompressData(data);
+
+    std::vector<uint8_t> decompressedData(data.size() + 1);
+
+    // Act and assert
+    ASSERT_FALSE(Decompress(compressedData.data(), compressedData.size(), decompressedData.data(), data.size() - 1));
+    ASSERT_FALSE(Decompress(compressedData.data(), compressedData.size(), decompressedData.data(), data.size() + 1));
+}
+
+TEST_F(TestCompression, DecompressTruncatedData) {
+    // Arrange
+    const std::vector<uint8_t> data(1000, GenerateU8());
+    const std::vector<uint8_t> compressedData = CompressData(data);
+
+    std::vector<uint8_t> decompressedData(data.size());
+
+    // Act and assert
+    for (size_t size = 0; size < compressedData.size(); size++) {
+        ASSERT_FALSE(Decompress(compressedData.data(), size, decompressedData.data(), data.size()));
+    }
+}
+
+TEST_F(TestCompression, DecompressOffsetBeforeStart) {
+    // Arrange
+    // Token with one literal and a match, which refers to two bytes before the start
+    const std::vector<uint8_t> compressedData = {0x10, 0xAB, 0x02, 0x00, 0x00};
+
+    std::vector<uint8_t> decompressedData(5);
+
+    // Act
+    const bool result =
+        Decompress(compressedData.data(), compressedData.size(), decompressedData.data(), decompressedData.size());
+
+    // Assert
+    ASSERT_FALSE(result);
+}
+
+}  // namespace
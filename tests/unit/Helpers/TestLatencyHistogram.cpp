@@ -0,0 +1,128 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "DsVeosCoSim/CoSimTypes.h"
+#include "LatencyHistogram.h"
+
+using namespace DsVeosCoSim;
+using namespace std::chrono;
+
+namespace {
+
+class TestLatencyHistogram : public testing::Test {};
+
+TEST_F(TestLatencyHistogram, EmptyHistogram) {
+    // Arrange
+    const LatencyHistogram histogram;
+
+    // Act
+    const LatencyStatistics statistics = histogram.GetStatistics();
+
+    // Assert
+    ASSERT_EQ(0U, statistics.count);
+    ASSERT_EQ(0ns, statistics.minimum);
+    ASSERT_EQ(0ns, statistics.maximum);
+    ASSERT_EQ(0ns, statistics.p999);
+}
+
+TEST_F(TestLatencyHistogram, SmallLatenciesAreExact) {
+    // Arrange
+    LatencyHistogram histogram;
+
+    // Act
+    for (int64_t i = 1; i <= 50; i++) {
+        histogram.Record(nanoseconds(i));
+    }
+
+    // Assert
+    const LatencyStatistics statistics = histogram.GetStatistics();
+    ASSERT_EQ(50U, statistics.count);
+    ASSERT_EQ(1ns, statistics.minimum);
+    ASSERT_EQ(50ns, statistics.maximum);
+    ASSERT_EQ(25ns, statistics.mean);
+    ASSERT_EQ(25ns, statistics.p50);
+    ASSERT_EQ(45ns, statistics.p90);
+    ASSERT_EQ(50ns, statistics.p99);
+    ASSERT_EQ(50ns, statistics.p999);
+}
+
+TEST_F(TestLatencyHistogram, PercentilesOfLargeLatencies) {
+    // Arrange
+    LatencyHistogram histogram;
+
+    // Act
+    for (int64_t i = 1; i <= 1000; i++) {
+        histogram.Record(microseconds(i));
+    }
+
+    // Assert
+    const LatencyStatistics statistics = histogram.GetStatistics();
+    ASSERT_EQ(1000U, statistics.count);
+    ASSERT_EQ(1us, statistics.minimum);
+    ASSERT_EQ(1000us, statistics.maximum);
+
+    const auto assertNear = [](const nanoseconds expected, const nanoseconds actual) {
+        ASSERT_GE(actual, expected);
+        ASSERT_LE(actual, expected + (expected / 32));
+    };
+    assertNear(500us, statistics.p50);
+    assertNear(900us, statistics.p90);
+    assertNear(990us, statistics.p99);
+    assertNear(999us, statistics.p999);
+}
+
+TEST_F(TestLatencyHistogram, BucketsCoverAllLatencies) {
+    // Arrange
+    uint64_t lowestLatency{};
+
+    // Act and assert
+    for (size_t i = 0; i < LatencyHistogram::BucketCount; i++) {
+        const uint64_t highestLatency = LatencyHistogram::GetHighestLatencyOfBucket(i);
+        ASSERT_EQ(i, LatencyHistogram::GetBucketIndex(lowestLatency));
+        ASSERT_EQ(i, LatencyHistogram::GetBucketIndex(highestLatency));
+        ASSERT_LE(highestLatency - lowestLatency, lowestLatency / LatencyHistogram::SubBucketCount);
+        lowestLatency = highestLatency + 1;
+    }
+
+    ASSERT_EQ(LatencyHistogram::BucketCount - 1, LatencyHistogram::GetBucketIndex(UINT64_MAX));
+}
+
+TEST_F(TestLatencyHistogram, Reset) {
+    // Arrange
+    LatencyHistogram histogram;
+    histogram.Record(5ms);
+
+    // Act
+    histogram.Reset();
+
+    // Assert
+    histogram.Record(2ms);
+    const LatencyStatistics statistics = histogram.GetStatistics();
+    ASSERT_EQ(1U, statistics.count);
+    ASSERT_EQ(2ms, statistics.minimum);
+    ASSERT_EQ(2ms, statistics.maximum);
+}
+
+TEST_F(TestLatencyHistogram, RecordPhasesOfCommands) {
+    // Arrange
+    LatencyRecorder recorder;
+    LatencyRecorder::Clock::time_point start = LatencyRecorder::Clock::now();
+
+    // Act
+    recorder.Record(Command::Step, LatencyPhase::Serialize, start);
+    recorder.Record(Command::Step, LatencyPhase::Send, start);
+    recorder.Record(Command::Step, LatencyPhase::Send, start);
+
+    // Assert
+    ASSERT_EQ(1U, recorder.GetStatistics(Command::Step, LatencyPhase::Serialize).count);
+    ASSERT_EQ(2U, recorder.GetStatistics(Command::Step, LatencyPhase::Send).count);
+    ASSERT_EQ(0U, recorder.GetStatistics(Command::Ping, LatencyPhase::Send).count);
+    ASSERT_THROW((void)recorder.GetStatistics(static_cast<Command>(100), LatencyPhase::Send), CoSimException);
+}
+
+}  // namespace
@@ -0,0 +1,310 @@
+// Copyright dSPACE GmbH. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Generator.h"
+#include "RingBuffer.h"
+#include "TestHelper.h"
+
+using namespace DsVeosCoSim;
+
+namespace {
+
+class TestRingBuffer : public testing::Test {};
+
+class TestArenaRingBuffer : public testing::Test {};
+
+class TestSpscRingBuffer : public testing::Test {};
+
+void PushBack(ArenaRingBuffer<uint64_t>& ringBuffer, const uint64_t header, const std::vector<uint8_t>& data) {
+    ringBuffer.PushBack(header, data.data(), static_cast<uint32_t>(data.size()));
+}
+
+void AssertPopFront(ArenaRingBuffer<uint64_t>& ringBuffer,
+                    const uint64_t expectedHeader,
+                    const std::vector<uint8_t>& expectedData) {
+    uint64_t header{};
+    uint32_t length{};
+    const uint8_t* data = ringBuffer.PopFront(header, length);
+
+    ASSERT_EQ(expectedHeader, header);
+    ASSERT_EQ(expectedData.size(), length);
+    AssertByteArray(expectedData.data(), data, length);
+}
+
+TEST_F(TestRingBuffer, PushBackSlotsInOrderAcrossWrapAround) {
+    // Arrange
+    RingBuffer<uint32_t> ringBuffer(3);
+
+    // Act and assert
+    for (uint32_t i = 0; i < 10; i++) {
+        ringBuffer.PushBackSlot() = i;
+        ringBuffer.PushBackSlot() = i + 100;
+
+        ASSERT_EQ(i, ringBuffer.PopFront());
+        ASSERT_EQ(i + 100, ringBuffer.PopFront());
+    }
+
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+TEST_F(TestRingBuffer, PushBackSlotWhenFull) {
+    // Arrange
+    RingBuffer<uint32_t> ringBuffer(2);
+    ringBuffer.PushBackSlot() = 1;
+    ringBuffer.PushBackSlot() = 2;
+
+    // Act and assert
+    ASSERT_THROW((void)ringBuffer.PushBackSlot(), std::runtime_error);
+    ASSERT_EQ(2, ringBuffer.Size());
+}
+
+TEST_F(TestRingBuffer, PushBackManyInOrderAcrossWrapAround) {
+    // Arrange
+    RingBuffer<uint32_t> ringBuffer(4);
+
+    // Act and assert
+    for (uint32_t i = 0; i < 10; i++) {
+        const uint32_t items[] = {i, i + 100, i + 200};
+        ringBuffer.PushBackMany(items, 3);
+
+        ASSERT_EQ(i, ringBuffer.PopFront());
+        ASSERT_EQ(i + 100, ringBuffer.PopFront());
+        ASSERT_EQ(i + 200, ringBuffer.PopFront());
+    }
+
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+TEST_F(TestRingBuffer, PushBackManyWhenNotEnoughSpace) {
+    // Arrange
+    RingBuffer<uint32_t> ringBuffer(3);
+    ringBuffer.PushBackSlot() = 1;
+    const uint32_t items[] = {2, 3, 4};
+
+    // Act and assert
+    ASSERT_THROW(ringBuffer.PushBackMany(items, 3), std::runtime_error);
+    ASSERT_EQ(1, ringBuffer.Size());
+}
+
+TEST_F(TestArenaRingBuffer, PopFromEmptyRingBuffer) {
+    // Arrange
+    ArenaRingBuffer<uint64_t> ringBuffer(1024);
+
+    uint64_t header{};
+    uint32_t length{};
+
+    // Act and assert
+    ASSERT_THROW((void)ringBuffer.PopFront(header, length), std::runtime_error);
+}
+
+TEST_F(TestArenaRingBuffer, PushAndPopInOrderAcrossWrapAround) {
+    // Arrange
+    constexpr size_t maxLength = 100;
+    ArenaRingBuffer<uint64_t> ringBuffer(ArenaRingBuffer<uint64_t>::GetRequiredCapacity(4, maxLength));
+
+    std::vector<std::vector<uint8_t>> items;
+    for (uint64_t i = 0; i < 4; i++) {
+        items.push_back(GenerateBytes(GenerateU32(0, maxLength)));
+    }
+
+    // Act and assert
+    for (uint64_t i = 0; i < 1000; i++) {
+        const size_t count = (i % 4) + 1;
+        for (size_t j = 0; j < count; j++) {
+            items[j] = GenerateBytes(GenerateU32(0, maxLength));
+            PushBack(ringBuffer, i + j, items[j]);
+        }
+
+        ASSERT_EQ(count, ringBuffer.Size());
+
+        for (size_t j = 0; j < count; j++) {
+            AssertPopFront(ringBuffer, i + j, items[j]);
+        }
+
+        ASSERT_TRUE(ringBuffer.IsEmpty());
+    }
+}
+
+TEST_F(TestArenaRingBuffer, PushAlwaysFitsIntoRequiredCapacity) {
+    // Arrange
+    constexpr size_t count = 8;
+    constexpr size_t maxLength = 1000;
+    ArenaRingBuffer<uint64_t> ringBuffer(ArenaRingBuffer<uint64_t>::GetRequiredCapacity(count, maxLength));
+
+    std::vector<std::vector<uint8_t>> items;
+    for (size_t i = 0; i < count; i++) {
+        items.push_back(GenerateBytes(GenerateU32(0, maxLength)));
+        PushBack(ringBuffer, i, items[i]);
+    }
+
+    // Act and assert
+    for (uint64_t i = count; i < 1000; i++) {
+        AssertPopFront(ringBuffer, i - count, items.front());
+        items.erase(items.begin());
+
+        items.push_back(GenerateBytes(GenerateU32(0, maxLength)));
+        PushBack(ringBuffer, i, items.back());
+
+        ASSERT_EQ(count, ringBuffer.Size());
+    }
+}
+
+TEST_F(TestArenaRingBuffer, GrowOnlyAsFarAsNeeded) {
+    // Arrange
+    constexpr size_t maxLength = 9018;
+    ArenaRingBuffer<uint64_t> ringBuffer(ArenaRingBuffer<uint64_t>::GetRequiredCapacity(512, maxLength));
+
+    const std::vector<uint8_t> data = GenerateBytes(64);
+
+    // Act
+    for (uint64_t i = 0; i < 512; i++) {
+        PushBack(ringBuffer, i, data);
+    }
+
+    // Assert
+    ASSERT_LE(ringBuffer.Capacity(), 512 * ArenaRingBuffer<uint64_t>::GetItemSize(data.size()) * 2);
+
+    for (uint64_t i = 0; i < 512; i++) {
+        AssertPopFront(ringBuffer, i, data);
+    }
+}
+
+TEST_F(TestArenaRingBuffer, GrowWhileWrappedAround) {
+    // Arrange
+    ArenaRingBuffer<uint64_t> ringBuffer(1024 * 1024);
+
+    const std::vector<uint8_t> data = GenerateBytes(1000);
+
+    for (uint64_t i = 0; i < 3; i++) {
+        PushBack(ringBuffer, i, data);
+    }
+
+    for (uint64_t i = 0; i < 2; i++) {
+        AssertPopFront(ringBuffer, i, data);
+    }
+
+    // Act
+    for (uint64_t i = 3; i < 100; i++) {
+        PushBack(ringBuffer, i, data);
+    }
+
+    // Assert
+    for (uint64_t i = 2; i < 100; i++) {
+        AssertPopFront(ringBuffer, i, data);
+    }
+
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+TEST_F(TestArenaRingBuffer, PushBeyondByteBudget) {
+    // Arrange
+    ArenaRingBuffer<uint64_t> ringBuffer(ArenaRingBuffer<uint64_t>::GetItemSize(100) * 2);
+
+    const std::vector<uint8_t> data = GenerateBytes(100);
+    PushBack(ringBuffer, 1, data);
+    PushBack(ringBuffer, 2, data);
+
+    // Act and assert
+    ASSERT_THROW(PushBack(ringBuffer, 3, data), std::runtime_error);
+    ASSERT_EQ(2, ringBuffer.Size());
+}
+
+TEST_F(TestArenaRingBuffer, ClearRingBuffer) {
+    // Arrange
+    ArenaRingBuffer<uint64_t> ringBuffer(1024);
+    PushBack(ringBuffer, 1, GenerateBytes(10));
+    PushBack(ringBuffer, 2, GenerateBytes(10));
+
+    // Act
+    ringBuffer.Clear();
+
+    // Assert
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+    ASSERT_EQ(0, ringBuffer.Size());
+}
+
+TEST_F(TestSpscRingBuffer, PopFromEmptyRingBuffer) {
+    // Arrange
+    SpscRingBuffer<uint32_t> ringBuffer(4);
+
+    uint32_t item{};
+
+    // Act
+    const bool result = ringBuffer.TryPopFront(item);
+
+    // Assert
+    ASSERT_FALSE(result);
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+TEST_F(TestSpscRingBuffer, PushUntilFull) {
+    // Arrange
+    SpscRingBuffer<uint32_t> ringBuffer(4);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ringBuffer.TryPushBack(uint32_t{i}));
+    }
+
+    // Act
+    const bool result = ringBuffer.TryPushBack(42);
+
+    // Assert
+    ASSERT_FALSE(result);
+    ASSERT_EQ(4, ringBuffer.Size());
+}
+
+TEST_F(TestSpscRingBuffer, PushAndPopInOrderAcrossWrapAround) {
+    // Arrange
+    SpscRingBuffer<uint32_t> ringBuffer(3);
+
+    // Act and assert
+    for (uint32_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(ringBuffer.TryPushBack(uint32_t{i}));
+        ASSERT_TRUE(ringBuffer.TryPushBack(uint32_t{i + 100}));
+        ASSERT_EQ(2, ringBuffer.Size());
+
+        uint32_t item{};
+        ASSERT_TRUE(ringBuffer.TryPopFront(item));
+        ASSERT_EQ(i, item);
+        ASSERT_TRUE(ringBuffer.TryPopFront(item));
+        ASSERT_EQ(i + 100, item);
+    }
+
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+TEST_F(TestSpscRingBuffer, PushAndPopFromDifferentThreads) {
+    // Arrange
+    constexpr uint32_t count = 100000;
+    SpscRingBuffer<uint32_t> ringBuffer(16);
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < count; i++) {
+            while (!ringBuffer.TryPushBack(uint32_t{i})) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Act and assert
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t item{};
+        while (!ringBuffer.TryPopFront(item)) {
+            std::this_thread::yield();
+        }
+
+        ASSERT_EQ(i, item);
+    }
+
+    producer.join();
+
+    ASSERT_TRUE(ringBuffer.IsEmpty());
+}
+
+}  // namespace
@@ -1,7 +1,5 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include <gtest/gtest.h>
 
 #include <string>
@@ -199,5 +197,3 @@ TEST_F(TestNamedEvent, SetAndWaitInDifferentThreads) {
 }
 
 }  // namespace
-
-#endif
@@ -1,10 +1,9 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include <gtest/gtest.h>
 
 #include <string>
+#include <thread>
 
 #include "Generator.h"
 #include "NamedMutex.h"
@@ -69,5 +68,3 @@ TEST_F(TestNamedMutex, LockAndUnlockOnDifferentMutexes) {
 }
 
 }  // namespace
-
-#endif
@@ -1,7 +1,5 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
-#ifdef _WIN32
-
 #include <gtest/gtest.h>
 
 #include <string>
@@ -79,5 +77,3 @@ TEST_F(TestSharedMemory, CouldNotOpenNonExisting) {
 }
 
 }  // namespace
-
-#endif
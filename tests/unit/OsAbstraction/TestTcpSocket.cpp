@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -205,4 +206,38 @@ TEST_P(TestTcpSocket, SendAndReceive) {
     ASSERT_EQ(sendValue, receiveValue);
 }
 
+TEST_P(TestTcpSocket, SendAndReceiveWithOptions) {
+    // Arrange
+    const Param param = GetParam();
+
+    TcpSocketOptions socketOptions{};
+    socketOptions.sendBufferSize = 1024 * 1024;
+    socketOptions.receiveBufferSize = 1024 * 1024;
+    socketOptions.enableQuickAck = true;
+    socketOptions.userTimeoutInMilliseconds = 10000;
+
+    Socket serverSocket(param.addressFamily);
+    serverSocket.ApplyOptions(socketOptions);
+    serverSocket.Bind(0, param.enableRemoteAccess);
+    const uint16_t port = serverSocket.GetLocalPort();
+    serverSocket.Listen();
+
+    std::optional<Socket> connectedSocket =
+        Socket::TryConnect(GetLoopBackAddress(param.addressFamily), port, 0, DefaultTimeout, socketOptions);
+    ASSERT_TRUE(connectedSocket);
+
+    Socket acceptedSocket = Accept(serverSocket);
+    acceptedSocket.ApplyOptions(socketOptions);
+
+    const uint32_t sendValue = GenerateU32();
+    uint32_t receiveValue = 0;
+
+    // Act
+    ASSERT_TRUE(SendComplete(*connectedSocket, &sendValue, sizeof(sendValue)));
+    ASSERT_TRUE(ReceiveComplete(acceptedSocket, &receiveValue, sizeof(receiveValue)));
+
+    // Assert
+    ASSERT_EQ(sendValue, receiveValue);
+}
+
 }  // namespace
@@ -2,10 +2,20 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
 #include "Generator.h"
 #include "Helper.h"
 #include "Socket.h"
 
+#ifndef _WIN32
+#include "IoUring.h"
+#endif
+
 using namespace DsVeosCoSim;
 
 namespace {
@@ -122,4 +132,78 @@ TEST_F(TestUdsSocket, SendAndReceive) {
     ASSERT_EQ(sendValue, receiveValue);
 }
 
+#ifndef _WIN32
+TEST_F(TestUdsSocket, SendAndReceiveThroughIoUring) {
+    // Arrange
+    constexpr auto addressFamily = AddressFamily::Uds;
+    const std::string path = GenerateString("UdsPath");
+
+    std::unique_ptr<IoUring> ioUring = IoUring::TryCreate();
+    if (!ioUring) {
+        GTEST_SKIP() << "io_uring is not supported.";
+    }
+
+    Socket serverSocket(addressFamily);
+    serverSocket.Bind(path);
+    serverSocket.Listen();
+
+    const Socket clientSocket(addressFamily);
+    EXPECT_TRUE(clientSocket.TryConnect(path));
+
+    const Socket acceptedSocket = Accept(serverSocket);
+
+    const uint32_t sendValue = GenerateU32();
+    uint32_t receiveValue = 0;
+
+    // Act
+    ASSERT_TRUE(SendComplete(clientSocket, &sendValue, sizeof(sendValue)));
+    int32_t receivedSize{};
+    ASSERT_TRUE(acceptedSocket.Receive(*ioUring,
+                                       &receiveValue,
+                                       sizeof(receiveValue),
+                                       receivedSize,
+                                       WaitMode::SpinThenBlock,
+                                       std::chrono::microseconds(100)));
+
+    // Assert
+    ASSERT_EQ(static_cast<int32_t>(sizeof(receiveValue)), receivedSize);
+    ASSERT_EQ(sendValue, receiveValue);
+}
+
+TEST_F(TestUdsSocket, ReceiveThroughIoUringAfterDisconnect) {
+    // Arrange
+    constexpr auto addressFamily = AddressFamily::Uds;
+    const std::string path = GenerateString("UdsPath");
+
+    std::unique_ptr<IoUring> ioUring = IoUring::TryCreate();
+    if (!ioUring) {
+        GTEST_SKIP() << "io_uring is not supported.";
+    }
+
+    Socket serverSocket(addressFamily);
+    serverSocket.Bind(path);
+    serverSocket.Listen();
+
+    std::optional<Socket> clientSocket(addressFamily);
+    EXPECT_TRUE(clientSocket->TryConnect(path));
+
+    const Socket acceptedSocket = Accept(serverSocket);
+    clientSocket.reset();
+
+    uint32_t receiveValue = 0;
+    int32_t receivedSize{};
+
+    // Act
+    const bool result = acceptedSocket.Receive(*ioUring,
+                                               &receiveValue,
+                                               sizeof(receiveValue),
+                                               receivedSize,
+                                               WaitMode::Block,
+                                               std::chrono::microseconds(0));
+
+    // Assert
+    ASSERT_FALSE(result);
+}
+#endif
+
 }  // namespace
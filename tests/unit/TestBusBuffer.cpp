@@ -4,16 +4,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <deque>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "BusBuffer.h"
 #include "DsVeosCoSim/CoSimTypes.h"
 #include "Generator.h"
 #include "Helper.h"
 #include "LogHelper.h"
+#include "Protocol.h"
 #include "TestHelper.h"
 
 using testing::Types;
@@ -26,22 +29,46 @@ namespace {
 [[nodiscard]] std::unique_ptr<BusBuffer> CreateBusBuffer(CoSimType coSimType,  // NOLINT
                                                          ConnectionKind connectionKind,
                                                          const std::string& name,
-                                                         const std::vector<CanController>& canControllers) {
-    return CreateBusBuffer(coSimType, connectionKind, name, canControllers, {}, {});
+                                                         const std::vector<CanController>& canControllers,
+                                                         uint32_t protocolVersion = CoSimProtocolVersion) {
+    return CreateBusBuffer(coSimType, connectionKind, protocolVersion, name, canControllers, {}, {});
 }
 
 [[nodiscard]] std::unique_ptr<BusBuffer> CreateBusBuffer(CoSimType coSimType,  // NOLINT
                                                          ConnectionKind connectionKind,
                                                          const std::string& name,
-                                                         const std::vector<EthController>& ethControllers) {
-    return CreateBusBuffer(coSimType, connectionKind, name, {}, ethControllers, {});
+                                                         const std::vector<EthController>& ethControllers,
+                                                         uint32_t protocolVersion = CoSimProtocolVersion) {
+    return CreateBusBuffer(coSimType, connectionKind, protocolVersion, name, {}, ethControllers, {});
 }
 
 [[nodiscard]] std::unique_ptr<BusBuffer> CreateBusBuffer(CoSimType coSimType,  // NOLINT
                                                          ConnectionKind connectionKind,
                                                          const std::string& name,
-                                                         const std::vector<LinController>& linControllers) {
-    return CreateBusBuffer(coSimType, connectionKind, name, {}, {}, linControllers);
+                                                         const std::vector<LinController>& linControllers,
+                                                         uint32_t protocolVersion = CoSimProtocolVersion) {
+    return CreateBusBuffer(coSimType, connectionKind, protocolVersion, name, {}, {}, linControllers);
+}
+
+// Accepts the id 0x100 and all ids 0x123456XX
+const std::vector<BusMessageIdFilter> AcceptanceFilters = {{0x7FF, 0x100}, {0xFFFFFF00, 0x12345600}};
+const std::vector<uint32_t> FilteredIds = {0x100, 0x101, 0x12345678, 0x22345678};
+
+[[nodiscard]] bool IsAccepted(const uint32_t id) {
+    return (id == 0x100) || (id == 0x12345678);
+}
+
+template <typename TControllerExtern>
+void SetAcceptanceFilter(const BusBuffer& busBuffer,
+                         const BusControllerId controllerId,
+                         const std::vector<BusMessageIdFilter>& filters) {
+    if constexpr (std::is_same_v<TControllerExtern, CanController>) {
+        busBuffer.SetCanAcceptanceFilter(controllerId, filters);
+    }
+
+    if constexpr (std::is_same_v<TControllerExtern, LinController>) {
+        busBuffer.SetLinAcceptanceFilter(controllerId, filters);
+    }
 }
 
 template <typename Types>
@@ -65,19 +92,11 @@ protected:
         _remoteSenderChannel = ConnectToTcpChannel("127.0.0.1", port);
         _remoteReceiverChannel = Accept(*remoteServer);
 
-#ifdef _WIN32
         const std::string name = GenerateString("LocalChannel名前");
         std::unique_ptr<ChannelServer> localServer = CreateLocalChannelServer(name);
 
         _localSenderChannel = ConnectToLocalChannel(name);
         _localReceiverChannel = Accept(*localServer);
-#else
-        const std::string name = GenerateString("UdsChannel名前");
-        std::unique_ptr<ChannelServer> localServer = CreateUdsChannelServer(name);
-
-        _localSenderChannel = ConnectToUdsChannel(name);
-        _localReceiverChannel = Accept(*localServer);
-#endif
     }
 
     static void TearDownTestSuite() {
@@ -104,10 +123,10 @@ protected:
         ChannelWriter& writer = connectionKind == ConnectionKind::Remote ? _remoteSenderChannel->GetWriter()
                                                                          : _localSenderChannel->GetWriter();
         std::thread thread([&] {
-            ASSERT_TRUE(receiverBusBuffer.Deserialize(reader, {}, {}));
+            ASSERT_TRUE(receiverBusBuffer.Deserialize(reader, {}, {}, {}));
         });
 
-        ASSERT_TRUE(senderBusBuffer.Serialize(writer));
+        ASSERT_TRUE(senderBusBuffer.Serialize(writer, {}));
         ASSERT_TRUE(writer.EndWrite());
 
         thread.join();
@@ -162,10 +181,10 @@ protected:
         }
 
         std::thread thread([&] {
-            ASSERT_TRUE(receiverBusBuffer.Deserialize(reader, simulationTime, callbacks));
+            ASSERT_TRUE(receiverBusBuffer.Deserialize(reader, simulationTime, simulationTime, callbacks));
         });
 
-        ASSERT_TRUE(senderBusBuffer.Serialize(writer));
+        ASSERT_TRUE(senderBusBuffer.Serialize(writer, simulationTime));
         ASSERT_TRUE(writer.EndWrite());
 
         thread.join();
@@ -673,6 +692,342 @@ TYPED_TEST(TestBusBuffer, ReceiveMultipleTransmittedMessages) {
     ASSERT_FALSE(receiverBusBuffer->Receive(receivedMessage));
 }
 
+TYPED_TEST(TestBusBuffer, ReceiveManyMessagesTransmittedAsBatch) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+
+    // Runs of messages for the same controller
+    const uint32_t count = controller1.queueSize + controller2.queueSize;
+    std::vector<TMessage> sendMessages(count);
+    std::vector<TMessageExtern> sendMessagesExtern(count);
+    for (uint32_t i = 0; i < count; i++) {
+        BusControllerId controllerId = i < controller1.queueSize ? controller1.id : controller2.id;
+        FillWithRandom(sendMessages[i], controllerId);
+        sendMessagesExtern[i] = static_cast<TMessageExtern>(sendMessages[i]);
+    }
+
+    ASSERT_EQ(count, senderBusBuffer->TransmitMany(sendMessagesExtern.data(), count));
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    std::vector<TMessageExtern> receivedMessages(count);
+    const uint32_t firstCount = count / 2;
+
+    // Act
+    const uint32_t firstReceivedCount = receiverBusBuffer->ReceiveMany(receivedMessages.data(), firstCount);
+    const uint32_t secondReceivedCount =
+        receiverBusBuffer->ReceiveMany(receivedMessages.data() + firstCount, count);
+
+    // Assert
+    ASSERT_EQ(firstCount, firstReceivedCount);
+    ASSERT_EQ(count - firstCount, secondReceivedCount);
+    for (uint32_t i = 0; i < count; i++) {
+        AssertEq(sendMessagesExtern[i], receivedMessages[i]);
+    }
+
+    ASSERT_EQ(0, receiverBusBuffer->ReceiveMany(receivedMessages.data(), count));
+}
+
+TYPED_TEST(TestBusBuffer, TransmitManyMessagesWhenBufferIsFull) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller{};
+    FillWithRandom(controller);
+
+    std::unique_ptr<BusBuffer> busBuffer =
+        CreateBusBuffer(coSimType, connectionKind, name, {static_cast<TControllerExtern>(controller)});
+
+    const uint32_t count = controller.queueSize + 1;
+    std::vector<TMessage> sendMessages(count);
+    std::vector<TMessageExtern> sendMessagesExtern(count);
+    for (uint32_t i = 0; i < count; i++) {
+        FillWithRandom(sendMessages[i], controller.id);
+        sendMessagesExtern[i] = static_cast<TMessageExtern>(sendMessages[i]);
+    }
+
+    // Act
+    const uint32_t transmittedCount = busBuffer->TransmitMany(sendMessagesExtern.data(), count);
+
+    // Assert
+    ASSERT_EQ(controller.queueSize, transmittedCount);
+    AssertLastMessage(fmt::format("Queue for controller '{}' is full. Messages are dropped.", controller.name));
+}
+
+TYPED_TEST(TestBusBuffer, ReceiveTransmittedMessagesPerController) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+
+    std::deque<TMessage> sendMessages1;
+    std::deque<TMessage> sendMessages2;
+
+    for (uint32_t i = 0; i < 10; i++) {
+        TMessage sendMessage{};
+        FillWithRandom(sendMessage, (i % 2) == 0 ? controller1.id : controller2.id);
+        ((i % 2) == 0 ? sendMessages1 : sendMessages2).push_back(sendMessage);
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessage)));
+    }
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    TMessageExtern receivedMessage{};
+
+    // Act and assert
+    ASSERT_TRUE(receiverBusBuffer->Receive(controller2.id, receivedMessage));
+    AssertEq(static_cast<TMessageExtern>(sendMessages2.front()), receivedMessage);
+    sendMessages2.pop_front();
+
+    ASSERT_TRUE(receiverBusBuffer->Receive(receivedMessage));
+    AssertEq(static_cast<TMessageExtern>(sendMessages1.front()), receivedMessage);
+    sendMessages1.pop_front();
+
+    while (!sendMessages2.empty()) {
+        ASSERT_TRUE(receiverBusBuffer->Receive(controller2.id, receivedMessage));
+        AssertEq(static_cast<TMessageExtern>(sendMessages2.front()), receivedMessage);
+        sendMessages2.pop_front();
+    }
+
+    ASSERT_FALSE(receiverBusBuffer->Receive(controller2.id, receivedMessage));
+
+    while (!sendMessages1.empty()) {
+        ASSERT_TRUE(receiverBusBuffer->Receive(receivedMessage));
+        AssertEq(static_cast<TMessageExtern>(sendMessages1.front()), receivedMessage);
+        sendMessages1.pop_front();
+    }
+
+    ASSERT_FALSE(receiverBusBuffer->Receive(receivedMessage));
+}
+
+TYPED_TEST(TestBusBuffer, KeepReceivedMessageWhileSkippingMessagesOfOtherController) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+
+    std::vector<TMessage> sendMessages1(2);
+    std::vector<TMessage> sendMessages2(2);
+    for (uint32_t i = 0; i < 2; i++) {
+        FillWithRandom(sendMessages1[i], controller1.id);
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessages1[i])));
+        FillWithRandom(sendMessages2[i], controller2.id);
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessages2[i])));
+    }
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    TMessageExtern receivedMessage1{};
+    TMessageExtern receivedMessage2{};
+    ASSERT_TRUE(receiverBusBuffer->Receive(controller2.id, receivedMessage2));
+    ASSERT_TRUE(receiverBusBuffer->Receive(controller1.id, receivedMessage1));
+
+    // Act
+    ASSERT_TRUE(receiverBusBuffer->Receive(controller2.id, receivedMessage2));
+
+    // Assert
+    AssertEq(static_cast<TMessageExtern>(sendMessages1[0]), receivedMessage1);
+    AssertEq(static_cast<TMessageExtern>(sendMessages2[1]), receivedMessage2);
+}
+
+TYPED_TEST(TestBusBuffer, ReceiveManyMessagesPerControllerOverMultipleTransfers) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+
+    // Act and assert
+    for (uint32_t transfer = 0; transfer < 3; transfer++) {
+        std::vector<TMessage> sendMessages1(controller1.queueSize);
+        std::vector<TMessage> sendMessages2(controller2.queueSize);
+        for (uint32_t i = 0; i < std::max(controller1.queueSize, controller2.queueSize); i++) {
+            if (i < controller1.queueSize) {
+                FillWithRandom(sendMessages1[i], controller1.id);
+                ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessages1[i])));
+            }
+
+            if (i < controller2.queueSize) {
+                FillWithRandom(sendMessages2[i], controller2.id);
+                ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessages2[i])));
+            }
+        }
+
+        TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+        std::vector<TMessageExtern> receivedMessages(controller1.queueSize + controller2.queueSize);
+
+        ASSERT_EQ(controller2.queueSize,
+                  receiverBusBuffer->ReceiveMany(controller2.id,
+                                                 receivedMessages.data(),
+                                                 static_cast<uint32_t>(receivedMessages.size())));
+        for (uint32_t i = 0; i < controller2.queueSize; i++) {
+            AssertEq(static_cast<TMessageExtern>(sendMessages2[i]), receivedMessages[i]);
+        }
+
+        ASSERT_EQ(controller1.queueSize,
+                  receiverBusBuffer->ReceiveMany(controller1.id,
+                                                 receivedMessages.data(),
+                                                 static_cast<uint32_t>(receivedMessages.size())));
+        for (uint32_t i = 0; i < controller1.queueSize; i++) {
+            AssertEq(static_cast<TMessageExtern>(sendMessages1[i]), receivedMessages[i]);
+        }
+    }
+
+    TMessageExtern receivedMessage{};
+    ASSERT_FALSE(receiverBusBuffer->Receive(receivedMessage));
+}
+
+TYPED_TEST(TestBusBuffer, ReceiveMultipleTransmittedMessagesWithLegacyEncoding) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)},
+                        CoSimProtocolVersion1_3);
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)},
+                        CoSimProtocolVersion1_3);
+
+    std::deque<TMessage> sendMessages;
+
+    for (uint32_t i = 0; i < controller1.queueSize + controller2.queueSize; i++) {
+        BusControllerId controllerId = (i % 2) == 0 ? controller1.id : controller2.id;
+        TMessage sendMessage{};
+        FillWithRandom(sendMessage, controllerId);
+        sendMessages.push_back(sendMessage);
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessage)));
+    }
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    TMessageExtern receivedMessage{};
+
+    // Act and Assert
+    for (uint32_t i = 0; i < controller1.queueSize + controller2.queueSize; i++) {
+        ASSERT_TRUE(receiverBusBuffer->Receive(receivedMessage));
+        AssertEq(static_cast<TMessageExtern>(sendMessages[i]), receivedMessage);
+    }
+
+    ASSERT_FALSE(receiverBusBuffer->Receive(receivedMessage));
+}
+
 TYPED_TEST(TestBusBuffer, ReceiveTransmittedMessagesByEventWithTransfer) {
     using TController = typename TypeParam::Controller;
     using TControllerExtern = typename TypeParam::ControllerExtern;
@@ -794,4 +1149,297 @@ TYPED_TEST(TestBusBuffer, DoNotReceiveNotFullyTransmittedMessageByEvent) {
                                        expectedEvents);  // Should not transfer anything
 }
 
+// ETH messages have no id, so only CAN and LIN buffers support acceptance filters
+template <typename Types>
+class TestFilteredBusBuffer : public TestBusBuffer<Types> {};
+
+using FilteredParameters = Types<Param<CanControllerContainer,
+                                       CanController,
+                                       CanMessageContainer,
+                                       CanMessage,
+                                       CoSimType::Client,
+                                       ConnectionKind::Local>,
+                                 Param<CanControllerContainer,
+                                       CanController,
+                                       CanMessageContainer,
+                                       CanMessage,
+                                       CoSimType::Client,
+                                       ConnectionKind::Remote>,
+                                 Param<CanControllerContainer,
+                                       CanController,
+                                       CanMessageContainer,
+                                       CanMessage,
+                                       CoSimType::Server,
+                                       ConnectionKind::Local>,
+                                 Param<CanControllerContainer,
+                                       CanController,
+                                       CanMessageContainer,
+                                       CanMessage,
+                                       CoSimType::Server,
+                                       ConnectionKind::Remote>,
+                                 Param<LinControllerContainer,
+                                       LinController,
+                                       LinMessageContainer,
+                                       LinMessage,
+                                       CoSimType::Client,
+                                       ConnectionKind::Local>,
+                                 Param<LinControllerContainer,
+                                       LinController,
+                                       LinMessageContainer,
+                                       LinMessage,
+                                       CoSimType::Client,
+                                       ConnectionKind::Remote>,
+                                 Param<LinControllerContainer,
+                                       LinController,
+                                       LinMessageContainer,
+                                       LinMessage,
+                                       CoSimType::Server,
+                                       ConnectionKind::Local>,
+                                 Param<LinControllerContainer,
+                                       LinController,
+                                       LinMessageContainer,
+                                       LinMessage,
+                                       CoSimType::Server,
+                                       ConnectionKind::Remote>>;
+
+TYPED_TEST_SUITE(TestFilteredBusBuffer, FilteredParameters, NameGenerator);
+
+TYPED_TEST(TestFilteredBusBuffer, ReceiveOnlyMessagesAcceptedByFilter) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller1{};
+    FillWithRandom(controller1);
+    TController controller2{};
+    FillWithRandom(controller2);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType,
+                        connectionKind,
+                        name,
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer =
+        CreateBusBuffer(GetCounterPart(coSimType),
+                        connectionKind,
+                        GetCounterPart(name, connectionKind),
+                        {static_cast<TControllerExtern>(controller1), static_cast<TControllerExtern>(controller2)});
+
+    SetAcceptanceFilter<TControllerExtern>(*receiverBusBuffer, controller1.id, AcceptanceFilters);
+
+    std::deque<TMessage> expectedMessages;
+
+    for (uint32_t i = 0; i < 20; i++) {
+        TMessage sendMessage{};
+        FillWithRandom(sendMessage, (i % 2) == 0 ? controller1.id : controller2.id);
+        if ((i % 2) == 0) {
+            sendMessage.id = static_cast<BusMessageId>(FilteredIds[(i / 2) % FilteredIds.size()]);
+        }
+
+        if ((sendMessage.controllerId == controller2.id) || IsAccepted(static_cast<uint32_t>(sendMessage.id))) {
+            expectedMessages.push_back(sendMessage);
+        }
+
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessage)));
+    }
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    TMessageExtern receivedMessage{};
+
+    // Act and assert
+    const auto firstMessage2 = std::find_if(expectedMessages.begin(),
+                                            expectedMessages.end(),
+                                            [&](const TMessage& message) {
+                                                return message.controllerId == controller2.id;
+                                            });
+    ASSERT_TRUE(receiverBusBuffer->Receive(controller2.id, receivedMessage));
+    AssertEq(static_cast<TMessageExtern>(*firstMessage2), receivedMessage);
+    expectedMessages.erase(firstMessage2);
+
+    while (!expectedMessages.empty()) {
+        ASSERT_TRUE(receiverBusBuffer->Receive(receivedMessage));
+        AssertEq(static_cast<TMessageExtern>(expectedMessages.front()), receivedMessage);
+        expectedMessages.pop_front();
+    }
+
+    ASSERT_FALSE(receiverBusBuffer->Receive(receivedMessage));
+}
+
+TYPED_TEST(TestFilteredBusBuffer, ReceiveOnlyMessagesAcceptedByFilterByEvent) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller{};
+    FillWithRandom(controller);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType, connectionKind, name, {static_cast<TControllerExtern>(controller)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer = CreateBusBuffer(GetCounterPart(coSimType),
+                                                                   connectionKind,
+                                                                   GetCounterPart(name, connectionKind),
+                                                                   {static_cast<TControllerExtern>(controller)});
+
+    SetAcceptanceFilter<TControllerExtern>(*receiverBusBuffer, controller.id, AcceptanceFilters);
+
+    std::deque<std::tuple<TControllerExtern, TMessage>> expectedEvents;
+
+    for (uint32_t i = 0; i < 10; i++) {
+        TMessage sendMessage{};
+        FillWithRandom(sendMessage, controller.id);
+        sendMessage.id = static_cast<BusMessageId>(FilteredIds[i % FilteredIds.size()]);
+        if (IsAccepted(static_cast<uint32_t>(sendMessage.id))) {
+            expectedEvents.push_back({static_cast<TControllerExtern>(controller), sendMessage});
+        }
+
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessage)));
+    }
+
+    // Act and assert
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer, expectedEvents);
+}
+
+TYPED_TEST(TestFilteredBusBuffer, ReceiveAllMessagesAfterFilterIsReset) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller{};
+    FillWithRandom(controller);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType, connectionKind, name, {static_cast<TControllerExtern>(controller)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer = CreateBusBuffer(GetCounterPart(coSimType),
+                                                                   connectionKind,
+                                                                   GetCounterPart(name, connectionKind),
+                                                                   {static_cast<TControllerExtern>(controller)});
+
+    SetAcceptanceFilter<TControllerExtern>(*receiverBusBuffer, controller.id, AcceptanceFilters);
+    SetAcceptanceFilter<TControllerExtern>(*receiverBusBuffer, controller.id, {});
+
+    std::vector<TMessage> sendMessages(FilteredIds.size());
+    for (size_t i = 0; i < sendMessages.size(); i++) {
+        FillWithRandom(sendMessages[i], controller.id);
+        sendMessages[i].id = static_cast<BusMessageId>(FilteredIds[i]);
+        ASSERT_TRUE(senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessages[i])));
+    }
+
+    TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+    std::vector<TMessageExtern> receivedMessages(sendMessages.size());
+
+    // Act
+    const uint32_t receivedCount =
+        receiverBusBuffer->ReceiveMany(receivedMessages.data(), static_cast<uint32_t>(receivedMessages.size()));
+
+    // Assert
+    ASSERT_EQ(sendMessages.size(), receivedCount);
+    for (size_t i = 0; i < sendMessages.size(); i++) {
+        AssertEq(static_cast<TMessageExtern>(sendMessages[i]), receivedMessages[i]);
+    }
+}
+
+// On the client, the model thread transmits while the protocol thread serializes. Local receivers read the messages
+// directly from the shared memory, which the protocol only allows while the client waits for the next step
+template <typename Types>
+class TestRemoteClientBusBuffer : public TestBusBuffer<Types> {};
+
+using RemoteClientParameters = Types<Param<CanControllerContainer,
+                                           CanController,
+                                           CanMessageContainer,
+                                           CanMessage,
+                                           CoSimType::Client,
+                                           ConnectionKind::Remote>,
+                                     Param<EthControllerContainer,
+                                           EthController,
+                                           EthMessageContainer,
+                                           EthMessage,
+                                           CoSimType::Client,
+                                           ConnectionKind::Remote>,
+                                     Param<LinControllerContainer,
+                                           LinController,
+                                           LinMessageContainer,
+                                           LinMessage,
+                                           CoSimType::Client,
+                                           ConnectionKind::Remote>>;
+
+TYPED_TEST_SUITE(TestRemoteClientBusBuffer, RemoteClientParameters, NameGenerator);
+
+TYPED_TEST(TestRemoteClientBusBuffer, TransmitFromOtherThreadWhileTransferring) {
+    using TController = typename TypeParam::Controller;
+    using TControllerExtern = typename TypeParam::ControllerExtern;
+    using TMessage = typename TypeParam::Message;
+    using TMessageExtern = typename TypeParam::MessageExtern;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusBuffer名前");
+
+    TController controller{};
+    FillWithRandom(controller);
+
+    std::unique_ptr<BusBuffer> senderBusBuffer =
+        CreateBusBuffer(coSimType, connectionKind, name, {static_cast<TControllerExtern>(controller)});
+    std::unique_ptr<BusBuffer> receiverBusBuffer = CreateBusBuffer(GetCounterPart(coSimType),
+                                                                   connectionKind,
+                                                                   GetCounterPart(name, connectionKind),
+                                                                   {static_cast<TControllerExtern>(controller)});
+
+    std::vector<TMessage> sendMessages(1000);
+    for (TMessage& sendMessage : sendMessages) {
+        FillWithRandom(sendMessage, controller.id);
+    }
+
+    // Act
+    std::thread modelThread([&] {
+        for (const TMessage& sendMessage : sendMessages) {
+            while (!senderBusBuffer->Transmit(static_cast<TMessageExtern>(sendMessage))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<TMessage> receivedMessages;
+    while (receivedMessages.size() < sendMessages.size()) {
+        TestBusBuffer<TypeParam>::Transfer(connectionKind, *senderBusBuffer, *receiverBusBuffer);
+
+        TMessageExtern receivedMessage{};
+        while (receiverBusBuffer->Receive(receivedMessage)) {
+            receivedMessages.push_back(static_cast<TMessage>(receivedMessage));
+        }
+    }
+
+    modelThread.join();
+
+    // Assert
+    ASSERT_EQ(sendMessages.size(), receivedMessages.size());
+    for (size_t i = 0; i < sendMessages.size(); i++) {
+        AssertEq(static_cast<TMessageExtern>(sendMessages[i]), static_cast<TMessageExtern>(receivedMessages[i]));
+    }
+}
+
 }  // namespace
@@ -2,8 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <string_view>  // IWYU pragma: keep
 #include <thread>
+#include <vector>
 
 #include "DsVeosCoSim/CoSimClient.h"
 #include "DsVeosCoSim/CoSimServer.h"
@@ -268,6 +270,635 @@ TEST_P(TestCoSim, DisconnectFromServerWithMandatoryClient) {
     ASSERT_TRUE(stoppedEvent.Wait(1000));
 }
 
+TEST_P(TestCoSim, StepServerWithMultipleClients) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 1;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.maxClientCount = 2;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const uint16_t port = server->GetLocalPort();
+
+    std::thread clientThreads[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        clientThreads[i] = std::thread([&, i] {
+            std::unique_ptr<CoSimClient> client = CreateClient();
+            if (!client->Connect(CreateConnectConfig(connectionKind, config.serverName, port))) {
+                return;
+            }
+
+            Callbacks callbacks{};
+            callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+                const uint32_t value = i + 42;
+                client->Write(signal.id, 1, &value);
+            };
+            (void)client->RunCallbackBasedCoSimulation(callbacks);
+        });
+
+        // The clients are accepted one after the other, so the order of the client ids is known
+        while (server->GetClientCount() == i) {
+            server->BackgroundService();
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    server->Start(GenerateSimulationTime());
+
+    // Act
+    (void)server->Step(GenerateSimulationTime());
+
+    // Assert
+    const std::vector<uint32_t> clientIds = server->GetClientIds();
+    ASSERT_EQ(2U, clientIds.size());
+    for (uint32_t i = 0; i < 2; i++) {
+        uint32_t length{};
+        const void* value{};
+        server->Read(clientIds[i], signal.id, length, &value);
+        ASSERT_EQ(1U, length);
+        ASSERT_EQ(i + 42, *static_cast<const uint32_t*>(value));
+    }
+
+    // Cleanup
+    server->Unload();
+    for (std::thread& clientThread : clientThreads) {
+        clientThread.join();
+    }
+}
+
+TEST_P(TestCoSim, ReadFromClientAfterOtherClientDisconnected) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 1;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.maxClientCount = 2;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const uint16_t port = server->GetLocalPort();
+
+    std::thread clientThreads[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        clientThreads[i] = std::thread([&, i] {
+            std::unique_ptr<CoSimClient> client = CreateClient();
+            if (!client->Connect(CreateConnectConfig(connectionKind, config.serverName, port))) {
+                return;
+            }
+
+            Callbacks callbacks{};
+            callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+                // The first client leaves without answering the step
+                if (i == 0) {
+                    client->Disconnect();
+                    return;
+                }
+
+                const uint32_t value = i + 42;
+                client->Write(signal.id, 1, &value);
+            };
+            (void)client->RunCallbackBasedCoSimulation(callbacks);
+        });
+
+        while (server->GetClientCount() == i) {
+            server->BackgroundService();
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    const std::vector<uint32_t> clientIds = server->GetClientIds();
+    ASSERT_EQ(2U, clientIds.size());
+
+    server->Start(GenerateSimulationTime());
+
+    // Act
+    try {
+        (void)server->Step(GenerateSimulationTime());
+    } catch (const CoSimException&) {
+        // The step fails for the disconnected client
+    }
+
+    // Assert
+    ASSERT_EQ(std::vector<uint32_t>{clientIds[1]}, server->GetClientIds());
+
+    uint32_t length{};
+    const void* value{};
+    ASSERT_THROW(server->Read(clientIds[0], signal.id, length, &value), CoSimException);
+
+    server->Read(clientIds[1], signal.id, length, &value);
+    ASSERT_EQ(43U, *static_cast<const uint32_t*>(value));
+
+    // The reads without a client id use the remaining client
+    server->Read(signal.id, length, &value);
+    ASSERT_EQ(43U, *static_cast<const uint32_t*>(value));
+
+    // Cleanup
+    server->Unload();
+    for (std::thread& clientThread : clientThreads) {
+        clientThread.join();
+    }
+}
+
+TEST_P(TestCoSim, InvokeCallbackOnceWhenMultipleClientsRequestSameCommand) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    uint32_t pausedCount{};
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.maxClientCount = 2;
+    config.simulationPausedCallback = [&](SimulationTime) {
+        pausedCount++;
+    };
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const uint16_t port = server->GetLocalPort();
+
+    std::thread clientThreads[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        clientThreads[i] = std::thread([&] {
+            std::unique_ptr<CoSimClient> client = CreateClient();
+            if (!client->Connect(CreateConnectConfig(connectionKind, config.serverName, port))) {
+                return;
+            }
+
+            Callbacks callbacks{};
+            callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+                client->Pause();
+            };
+            (void)client->RunCallbackBasedCoSimulation(callbacks);
+        });
+
+        while (server->GetClientCount() == i) {
+            server->BackgroundService();
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    server->Start(GenerateSimulationTime());
+
+    // Act
+    (void)server->Step(GenerateSimulationTime());
+
+    // Assert
+    ASSERT_EQ(1U, pausedCount);
+
+    // Cleanup
+    server->Unload();
+    for (std::thread& clientThread : clientThreads) {
+        clientThread.join();
+    }
+}
+
+TEST_P(TestCoSim, StepServerWithPipelinedClient) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 1;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.enablePipelinedSteps = true;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, server->GetLocalPort());
+    connectConfig.enablePipelinedSteps = true;
+
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (!client->Connect(connectConfig)) {
+            return;
+        }
+
+        uint32_t stepCount{};
+        Callbacks callbacks{};
+        callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+            stepCount++;
+            client->Write(signal.id, 1, &stepCount);
+        };
+        (void)client->RunCallbackBasedCoSimulation(callbacks);
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    server->Start(GenerateSimulationTime());
+
+    for (uint32_t i = 0; i < 3; i++) {
+        // Act
+        (void)server->Step(GenerateSimulationTime());
+
+        // Assert
+        uint32_t length{};
+        const void* value{};
+        server->Read(signal.id, length, &value);
+        ASSERT_EQ(i, *static_cast<const uint32_t*>(value));
+    }
+
+    // Cleanup
+    server->Stop(GenerateSimulationTime());
+    server->Unload();
+    clientThread.join();
+}
+
+TEST_P(TestCoSim, StepServerWithSpinningClient) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 1;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.waitMode = WaitMode::SpinThenBlock;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, server->GetLocalPort());
+    connectConfig.waitMode = WaitMode::SpinThenBlock;
+
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (!client->Connect(connectConfig)) {
+            return;
+        }
+
+        uint32_t stepCount{};
+        Callbacks callbacks{};
+        callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+            stepCount++;
+            client->Write(signal.id, 1, &stepCount);
+        };
+        (void)client->RunCallbackBasedCoSimulation(callbacks);
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    server->Start(GenerateSimulationTime());
+
+    for (uint32_t i = 1; i <= 3; i++) {
+        // Act
+        (void)server->Step(GenerateSimulationTime());
+
+        // Assert
+        uint32_t length{};
+        const void* value{};
+        server->Read(signal.id, length, &value);
+        ASSERT_EQ(i, *static_cast<const uint32_t*>(value));
+    }
+
+    // Cleanup
+    server->Stop(GenerateSimulationTime());
+    server->Unload();
+    clientThread.join();
+}
+
+TEST_P(TestCoSim, StepServerWithCompression) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 10000;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.enableCompression = true;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, server->GetLocalPort());
+    connectConfig.enableCompression = true;
+
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (!client->Connect(connectConfig)) {
+            return;
+        }
+
+        std::vector<uint32_t> values(signal.length);
+        Callbacks callbacks{};
+        callbacks.simulationBeginStepCallback = [&](SimulationTime) {
+            for (uint32_t& value : values) {
+                value++;
+            }
+
+            client->Write(signal.id, signal.length, values.data());
+        };
+        (void)client->RunCallbackBasedCoSimulation(callbacks);
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    server->Start(GenerateSimulationTime());
+
+    for (uint32_t i = 1; i <= 3; i++) {
+        // Act
+        (void)server->Step(GenerateSimulationTime());
+
+        // Assert
+        uint32_t length{};
+        const void* value{};
+        server->Read(signal.id, length, &value);
+        ASSERT_EQ(signal.length, length);
+        ASSERT_EQ(i, static_cast<const uint32_t*>(value)[0]);
+        ASSERT_EQ(i, static_cast<const uint32_t*>(value)[signal.length - 1]);
+    }
+
+    // Cleanup
+    server->Stop(GenerateSimulationTime());
+    server->Unload();
+    clientThread.join();
+}
+
+TEST_P(TestCoSim, RecordLatencyStatistics) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    constexpr uint32_t StepCount = 10;
+    constexpr auto CallbackTime = 1ms;
+
+    CoSimServerConfig config = CreateServerConfig();
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, server->GetLocalPort());
+
+    LatencyStatistics clientStepWait{};
+    LatencyStatistics clientStepCallback{};
+    LatencyStatistics clientStepSerialize{};
+    LatencyStatistics clientStartDeserialize{};
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (!client->Connect(connectConfig)) {
+            return;
+        }
+
+        Callbacks callbacks{};
+        callbacks.simulationEndStepCallback = [&](SimulationTime) {
+            std::this_thread::sleep_for(CallbackTime);
+        };
+        (void)client->RunCallbackBasedCoSimulation(callbacks);
+
+        clientStepWait = client->GetLatencyStatistics(Command::Step, LatencyPhase::Wait);
+        clientStepCallback = client->GetLatencyStatistics(Command::Step, LatencyPhase::Callback);
+        clientStepSerialize = client->GetLatencyStatistics(Command::Step, LatencyPhase::Serialize);
+        clientStartDeserialize = client->GetLatencyStatistics(Command::Start, LatencyPhase::Deserialize);
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    server->Start(GenerateSimulationTime());
+    server->ResetLatencyStatistics();
+
+    // Act
+    for (uint32_t i = 0; i < StepCount; i++) {
+        (void)server->Step(GenerateSimulationTime());
+    }
+
+    // Assert
+    for (const LatencyPhase phase :
+         {LatencyPhase::Serialize, LatencyPhase::Send, LatencyPhase::Wait, LatencyPhase::Deserialize}) {
+        ASSERT_EQ(StepCount, server->GetLatencyStatistics(Command::Step, phase).count);
+    }
+
+    const LatencyStatistics serverStepWait = server->GetLatencyStatistics(Command::Step, LatencyPhase::Wait);
+    ASSERT_GE(serverStepWait.minimum, CallbackTime);
+    ASSERT_LE(serverStepWait.minimum, serverStepWait.p50);
+    ASSERT_LE(serverStepWait.p50, serverStepWait.p90);
+    ASSERT_LE(serverStepWait.p90, serverStepWait.p99);
+    ASSERT_LE(serverStepWait.p99, serverStepWait.p999);
+    ASSERT_LE(serverStepWait.p999, serverStepWait.maximum);
+    ASSERT_EQ(0U, server->GetLatencyStatistics(Command::Start, LatencyPhase::Wait).count);
+
+    // Cleanup
+    server->Stop(GenerateSimulationTime());
+    server->Unload();
+    clientThread.join();
+
+    ASSERT_EQ(StepCount, clientStepWait.count);
+    ASSERT_EQ(StepCount, clientStepCallback.count);
+    ASSERT_EQ(StepCount, clientStepSerialize.count);
+    ASSERT_GE(clientStepCallback.minimum, CallbackTime);
+    ASSERT_EQ(1U, clientStartDeserialize.count);
+}
+
+TEST_P(TestCoSim, RecordOneWaitLatencyPerStepWithMultipleClients) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    constexpr uint32_t StepCount = 5;
+    constexpr auto CallbackTime = 1ms;
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.maxClientCount = 2;
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const uint16_t port = server->GetLocalPort();
+
+    std::thread clientThreads[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        clientThreads[i] = std::thread([&] {
+            std::unique_ptr<CoSimClient> client = CreateClient();
+            if (!client->Connect(CreateConnectConfig(connectionKind, config.serverName, port))) {
+                return;
+            }
+
+            Callbacks callbacks{};
+            callbacks.simulationEndStepCallback = [&](SimulationTime) {
+                std::this_thread::sleep_for(CallbackTime);
+            };
+            (void)client->RunCallbackBasedCoSimulation(callbacks);
+        });
+
+        while (server->GetClientCount() == i) {
+            server->BackgroundService();
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    server->Start(GenerateSimulationTime());
+    server->ResetLatencyStatistics();
+
+    // Act
+    for (uint32_t i = 0; i < StepCount; i++) {
+        (void)server->Step(GenerateSimulationTime());
+    }
+
+    // Assert
+    const LatencyStatistics serverStepWait = server->GetLatencyStatistics(Command::Step, LatencyPhase::Wait);
+    ASSERT_EQ(StepCount, serverStepWait.count);
+    ASSERT_GE(serverStepWait.minimum, CallbackTime);
+    ASSERT_EQ(StepCount * 2, server->GetLatencyStatistics(Command::Step, LatencyPhase::Deserialize).count);
+
+    // Cleanup
+    server->Stop(GenerateSimulationTime());
+    server->Unload();
+    for (std::thread& clientThread : clientThreads) {
+        clientThread.join();
+    }
+}
+
+TEST_P(TestCoSim, StepNServerWithClient) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    IoSignalContainer signal{};
+    signal.id = static_cast<IoSignalId>(1);
+    signal.length = 1;
+    signal.dataType = DataType::UInt32;
+    signal.sizeKind = SizeKind::Fixed;
+    signal.name = "Signal";
+
+    CoSimServerConfig config = CreateServerConfig();
+    config.stepSize = 1ms;
+    config.outgoingSignals = {signal};
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, server->GetLocalPort());
+    connectConfig.enableStepN = true;
+
+    std::vector<SimulationTime> stepTimes;
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (!client->Connect(connectConfig)) {
+            return;
+        }
+
+        Callbacks callbacks{};
+        callbacks.simulationBeginStepCallback = [&](const SimulationTime simulationTime) {
+            stepTimes.push_back(simulationTime);
+            const auto stepCount = static_cast<uint32_t>(stepTimes.size());
+            client->Write(signal.id, 1, &stepCount);
+        };
+        (void)client->RunCallbackBasedCoSimulation(callbacks);
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    server->Start(0s);
+
+    // Act
+    (void)server->StepN(10ms, 5);
+
+    // Assert
+    uint32_t length{};
+    const void* value{};
+    server->Read(signal.id, length, &value);
+    ASSERT_EQ(5U, *static_cast<const uint32_t*>(value));
+
+    const std::vector<SimulationTime> expectedStepTimes = {10ms, 11ms, 12ms, 13ms, 14ms};
+    ASSERT_EQ(expectedStepTimes, stepTimes);
+
+    // Cleanup
+    server->Unload();
+    clientThread.join();
+}
+
+TEST_P(TestCoSim, ConnectMoreClientsThanAllowed) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+
+    const CoSimServerConfig config = CreateServerConfig();
+
+    std::unique_ptr<CoSimServer> server = CreateServer();
+    server->Load(config);
+
+    const uint16_t port = server->GetLocalPort();
+
+    const ConnectConfig connectConfig = CreateConnectConfig(connectionKind, config.serverName, port);
+
+    std::thread clientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        if (client->Connect(connectConfig)) {
+            (void)client->RunCallbackBasedCoSimulation({});
+        }
+    });
+
+    while (server->GetClientCount() == 0) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    std::atomic<bool> isConnectFinished{};
+    bool isConnected{};
+    std::thread secondClientThread([&] {
+        std::unique_ptr<CoSimClient> client = CreateClient();
+        isConnected = client->Connect(connectConfig);
+        isConnectFinished = true;
+    });
+
+    // Act
+    while (!isConnectFinished) {
+        server->BackgroundService();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    // Assert
+    secondClientThread.join();
+    ASSERT_FALSE(isConnected);
+    ASSERT_EQ(1U, server->GetClientCount());
+
+    // Cleanup
+    server->Unload();
+    clientThread.join();
+}
+
 // Add more tests
 
 }  // namespace
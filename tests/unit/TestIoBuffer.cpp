@@ -13,6 +13,7 @@
 #include "Helper.h"
 #include "IoBuffer.h"
 #include "LogHelper.h"
+#include "Protocol.h"
 #include "TestHelper.h"
 
 using namespace DsVeosCoSim;
@@ -72,7 +73,7 @@ TEST_P(TestIoBufferWithCoSimType, CreateWithZeroIoSignalInfos) {
     const std::string name = GenerateString("IoBuffer名前");
 
     // Act
-    std::unique_ptr<IoBuffer> ioBuffer = CreateIoBuffer(coSimType, connectionKind, name, {}, {});
+    std::unique_ptr<IoBuffer> ioBuffer = CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, {}, {});
 
     // Assert
     ASSERT_TRUE(ioBuffer);
@@ -177,6 +178,7 @@ TEST_P(TestIoBuffer, CreateWithSingleIoSignalInfo) {
     // Act and assert
     ASSERT_NO_THROW((void)CreateIoBuffer(coSimType,
                                          connectionKind,
+                                         CoSimProtocolVersion,
                                          name,
                                          {static_cast<IoSignal>(incomingSignal)},
                                          {static_cast<IoSignal>(outgoingSignal)}));
@@ -197,6 +199,7 @@ TEST_P(TestIoBuffer, CreateWithMultipleIoSignalInfos) {
     ASSERT_NO_THROW(
         (void)CreateIoBuffer(coSimType,
                              connectionKind,
+                             CoSimProtocolVersion,
                              name,
                              {static_cast<IoSignal>(incomingSignal1), static_cast<IoSignal>(incomingSignal2)},
                              {static_cast<IoSignal>(outgoingSignal1), static_cast<IoSignal>(outgoingSignal2)}));
@@ -215,7 +218,7 @@ TEST_P(TestIoBuffer, InitialDataOfFixedSizedSignal) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     const std::unique_ptr<IoBuffer> ioBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     const std::vector<uint8_t> initialValue = CreateZeroedIoData(signal);
 
@@ -243,7 +246,7 @@ TEST_P(TestIoBuffer, InitialDataOfVariableSizedSignal) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     const std::unique_ptr<IoBuffer> ioBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     uint32_t readLength{};
     std::vector<uint8_t> readValue = CreateZeroedIoData(signal);
@@ -270,7 +273,7 @@ TEST_P(TestIoBuffer, WriteFixedSizedData) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     const std::unique_ptr<IoBuffer> ioBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     const std::vector<uint8_t> writeValue = GenerateIoData(signal);
 
@@ -292,10 +295,11 @@ TEST_P(TestIoBuffer, WriteFixedSizedDataAndRead) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -316,6 +320,323 @@ TEST_P(TestIoBuffer, WriteFixedSizedDataAndRead) {
     AssertByteArray(writeValue.data(), readValue.data(), writeValue.size());
 }
 
+TEST_P(TestIoBuffer, WriteFixedSizedDataWithDenseSignalIdsAndRead) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (uint32_t i = 0; i < 10; i++) {
+        IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+        signal.id = static_cast<IoSignalId>(9 - i);
+        signals.push_back(signal);
+    }
+
+    for (const IoSignalContainer& signal : signals) {
+        outgoingSignals.push_back(static_cast<IoSignal>(signal));
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<std::vector<uint8_t>> writeValues;
+    for (const IoSignalContainer& signal : signals) {
+        writeValues.push_back(GenerateIoData(signal));
+        writerIoBuffer->Write(signal.id, signal.length, writeValues.back().data());
+    }
+
+    Transfer(*writerIoBuffer, *readerIoBuffer);
+
+    for (size_t i = 0; i < signals.size(); i++) {
+        uint32_t readLength{};
+        std::vector<uint8_t> readValue = CreateZeroedIoData(signals[i]);
+
+        // Act
+        ASSERT_NO_THROW(readerIoBuffer->Read(signals[i].id, readLength, readValue.data()));
+
+        // Assert
+        ASSERT_EQ(signals[i].length, readLength);
+        AssertByteArray(writeValues[i].data(), readValue.data(), writeValues[i].size());
+    }
+}
+
+TEST_P(TestIoBuffer, ReadUnknownSignalIdWithDenseSignalIds) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    signal.id = static_cast<IoSignalId>(1);
+
+    std::vector incomingSignals = {static_cast<IoSignal>(signal)};
+    std::vector<IoSignal> outgoingSignals;
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    const std::unique_ptr<IoBuffer> ioBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    uint32_t readLength{};
+    std::vector<uint8_t> readValue = CreateZeroedIoData(signal);
+
+    // Act and assert
+    ASSERT_THROW(ioBuffer->Read(static_cast<IoSignalId>(0), readLength, readValue.data()), CoSimException);
+    ASSERT_THROW(ioBuffer->Read(static_cast<IoSignalId>(2), readLength, readValue.data()), CoSimException);
+}
+
+TEST_P(TestIoBuffer, WriteMultipleSignalsAndReadMultipleSignals) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (uint32_t i = 0; i < 3; i++) {
+        signals.push_back(CreateSignal(dataType, (i % 2 == 0) ? SizeKind::Fixed : SizeKind::Variable));
+        outgoingSignals.push_back(static_cast<IoSignal>(signals.back()));
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<std::vector<uint8_t>> writeValues;
+    std::vector<IoSignalWriteValue> writeSignals;
+    for (const IoSignalContainer& signal : signals) {
+        writeValues.push_back(GenerateIoData(signal));
+        writeSignals.push_back({signal.id, signal.length, writeValues.back().data()});
+    }
+
+    writerIoBuffer->WriteSignals(static_cast<uint32_t>(writeSignals.size()), writeSignals.data());
+
+    Transfer(*writerIoBuffer, *readerIoBuffer);
+
+    std::vector<std::vector<uint8_t>> readValues;
+    std::vector<IoSignalReadValue> readSignals;
+    for (const IoSignalContainer& signal : signals) {
+        readValues.push_back(CreateZeroedIoData(signal));
+        readSignals.push_back({signal.id, 0, readValues.back().data()});
+    }
+
+    // Act
+    ASSERT_NO_THROW(readerIoBuffer->ReadSignals(static_cast<uint32_t>(readSignals.size()), readSignals.data()));
+
+    // Assert
+    for (size_t i = 0; i < signals.size(); i++) {
+        ASSERT_EQ(signals[i].length, readSignals[i].length);
+        AssertByteArray(writeValues[i].data(), readValues[i].data(), writeValues[i].size());
+    }
+}
+
+TEST_P(TestIoBuffer, WriteMultipleSignalsWithInvalidLengthDoesNotWriteAnySignal) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (uint32_t i = 0; i < 3; i++) {
+        signals.push_back(CreateSignal(dataType, (i % 2 == 0) ? SizeKind::Fixed : SizeKind::Variable));
+        outgoingSignals.push_back(static_cast<IoSignal>(signals.back()));
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<std::vector<uint8_t>> writeValues;
+    std::vector<IoSignalWriteValue> writeSignals;
+    for (const IoSignalContainer& signal : signals) {
+        writeValues.push_back(GenerateIoData(signal));
+        writeSignals.push_back({signal.id, signal.length, writeValues.back().data()});
+    }
+
+    // The last signal has a fixed size, so any other length is rejected
+    writeSignals.back().length++;
+
+    // Act
+    ASSERT_THROW(writerIoBuffer->WriteSignals(static_cast<uint32_t>(writeSignals.size()), writeSignals.data()),
+                 CoSimException);
+
+    // Assert
+    TransferWithEvents(*writerIoBuffer, *readerIoBuffer, {});
+}
+
+TEST_P(TestIoBuffer, WriteMultipleSignalsWithProtocolVersion1_3AndReadMultipleSignals) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (uint32_t i = 0; i < 3; i++) {
+        signals.push_back(CreateSignal(dataType, (i % 2 == 0) ? SizeKind::Fixed : SizeKind::Variable));
+        outgoingSignals.push_back(static_cast<IoSignal>(signals.back()));
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion1_3, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion1_3,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<std::vector<uint8_t>> writeValues;
+    std::vector<IoSignalWriteValue> writeSignals;
+    for (const IoSignalContainer& signal : signals) {
+        writeValues.push_back(GenerateIoData(signal));
+        writeSignals.push_back({signal.id, signal.length, writeValues.back().data()});
+    }
+
+    writerIoBuffer->WriteSignals(static_cast<uint32_t>(writeSignals.size()), writeSignals.data());
+
+    Transfer(*writerIoBuffer, *readerIoBuffer);
+
+    std::vector<std::vector<uint8_t>> readValues;
+    std::vector<IoSignalReadValue> readSignals;
+    for (const IoSignalContainer& signal : signals) {
+        readValues.push_back(CreateZeroedIoData(signal));
+        readSignals.push_back({signal.id, 0, readValues.back().data()});
+    }
+
+    // Act
+    ASSERT_NO_THROW(readerIoBuffer->ReadSignals(static_cast<uint32_t>(readSignals.size()), readSignals.data()));
+
+    // Assert
+    for (size_t i = 0; i < signals.size(); i++) {
+        ASSERT_EQ(signals[i].length, readSignals[i].length);
+        AssertByteArray(writeValues[i].data(), readValues[i].data(), writeValues[i].size());
+    }
+}
+
+TEST_P(TestIoBuffer, WriteFixedSizedDataWithHandleAndReadWithHandle) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer signal1 = CreateSignal();
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {static_cast<IoSignal>(signal1), static_cast<IoSignal>(signal)};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    const IoSignalHandle writeHandle = writerIoBuffer->GetWriteSignalHandle(signal.id);
+    const IoSignalHandle readHandle = readerIoBuffer->GetReadSignalHandle(signal.id);
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+    writerIoBuffer->WriteFast(writeHandle, signal.length, writeValue.data());
+
+    uint32_t readLength{};
+    std::vector<uint8_t> readValue = CreateZeroedIoData(signal);
+
+    TransferWithEvents(*writerIoBuffer, *readerIoBuffer, {{signal, writeValue}});
+
+    // Act
+    ASSERT_NO_THROW(readerIoBuffer->ReadFast(readHandle, readLength, readValue.data()));
+
+    // Assert
+    ASSERT_EQ(signal.length, readLength);
+    AssertByteArray(writeValue.data(), readValue.data(), writeValue.size());
+}
+
+TEST_P(TestIoBuffer, GetHandleOfUnknownSignalId) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+
+    std::vector incomingSignals = {static_cast<IoSignal>(signal)};
+    std::vector<IoSignal> outgoingSignals;
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    const std::unique_ptr<IoBuffer> ioBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    // Act and assert
+    ASSERT_NO_THROW((void)ioBuffer->GetReadSignalHandle(signal.id));
+    ASSERT_THROW((void)ioBuffer->GetWriteSignalHandle(signal.id), CoSimException);
+}
+
+TEST_P(TestIoBuffer, WriteAndReadWithInvalidHandleOrLength) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Variable);
+
+    std::vector incomingSignals = {static_cast<IoSignal>(signal)};
+    std::vector outgoingSignals = {static_cast<IoSignal>(signal)};
+
+    const std::unique_ptr<IoBuffer> ioBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    const IoSignalHandle writeHandle = ioBuffer->GetWriteSignalHandle(signal.id);
+    const auto invalidHandle = static_cast<IoSignalHandle>(1);
+
+    const std::vector<uint8_t> writeValue(GetDataTypeSize(dataType) * (signal.length + 1));
+    std::vector<uint8_t> readValue(writeValue.size());
+    uint32_t readLength{};
+
+    // Act and assert
+    ASSERT_THROW(ioBuffer->WriteFast(writeHandle, signal.length + 1, writeValue.data()), CoSimException);
+    ASSERT_THROW(ioBuffer->WriteFast(invalidHandle, 1, writeValue.data()), CoSimException);
+    ASSERT_THROW(ioBuffer->ReadFast(invalidHandle, readLength, readValue.data()), CoSimException);
+}
+
 TEST_P(TestIoBuffer, WriteFixedSizedDataTwiceAndReadLatestValue) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -330,10 +651,11 @@ TEST_P(TestIoBuffer, WriteFixedSizedDataTwiceAndReadLatestValue) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -375,10 +697,11 @@ TEST_P(TestIoBuffer, WriteFixedSizedDataAndReceiveEvent) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -408,10 +731,11 @@ TEST_P(TestIoBuffer, WriteFixedSizedDataTwiceAndReceiveOneEvent) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -444,10 +768,11 @@ TEST_P(TestIoBuffer, NoNewEventIfFixedSizedDataDoesNotChangeWithSharedMemory) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -477,10 +802,11 @@ TEST_P(TestIoBuffer, WriteVariableSizedDataAndReceiveEvent) {
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -508,10 +834,11 @@ TEST_P(TestIoBuffer, WriteVariableSizedDataWhereOnlyOneElementChangedAndReceiveE
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -529,6 +856,125 @@ TEST_P(TestIoBuffer, WriteVariableSizedDataWhereOnlyOneElementChangedAndReceiveE
     }
 }
 
+TEST_P(TestIoBuffer, WriteLargeFixedSizedDataWhereOnlyLastElementChangedAndReceiveEvent) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    signal.length = 5000;
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {static_cast<IoSignal>(signal)};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<uint8_t> writeValue = CreateZeroedIoData(signal);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        // Only change the last byte, so that only the last block is changed
+        ++writeValue.back();
+        writerIoBuffer->Write(signal.id, signal.length, writeValue.data());
+
+        // Act and assert
+        TransferWithEvents(*writerIoBuffer, *readerIoBuffer, {{signal, writeValue}});
+    }
+}
+
+TEST_P(TestIoBuffer, WriteLargeVariableSizedDataWithChangingLengthAndRead) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Variable);
+    signal.length = 5000;
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {static_cast<IoSignal>(signal)};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    const std::vector<uint8_t> fullValue = GenerateIoData(signal);
+    std::vector<uint8_t> changedValue = fullValue;
+    ++changedValue.back();
+
+    const size_t dataTypeSize = fullValue.size() / signal.length;
+    const std::vector<std::pair<uint32_t, const std::vector<uint8_t>*>> writes = {{signal.length, &fullValue},
+                                                                                  {signal.length, &changedValue},
+                                                                                  {10, &fullValue},
+                                                                                  {signal.length, &changedValue},
+                                                                                  {signal.length, &fullValue}};
+
+    for (const auto& [writeLength, writeValue] : writes) {
+        writerIoBuffer->Write(signal.id, writeLength, writeValue->data());
+        Transfer(*writerIoBuffer, *readerIoBuffer);
+
+        uint32_t readLength{};
+        std::vector<uint8_t> readValue = CreateZeroedIoData(signal);
+
+        // Act
+        readerIoBuffer->Read(signal.id, readLength, readValue.data());
+
+        // Assert
+        ASSERT_EQ(writeLength, readLength);
+        AssertByteArray(writeValue->data(), readValue.data(), writeLength * dataTypeSize);
+    }
+}
+
+TEST_P(TestIoBuffer, WriteLargeFixedSizedDataWithProtocolVersion1_0AndRead) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    const std::string name = GenerateString("IoBuffer名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    signal.length = 5000;
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {static_cast<IoSignal>(signal)};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<IoBuffer> writerIoBuffer =
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion1_0, name, incomingSignals, outgoingSignals);
+
+    std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
+                                                              connectionKind,
+                                                              CoSimProtocolVersion1_0,
+                                                              GetCounterPart(name, connectionKind),
+                                                              incomingSignals,
+                                                              outgoingSignals);
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        ++writeValue.back();
+        writerIoBuffer->Write(signal.id, signal.length, writeValue.data());
+
+        // Act and assert
+        TransferWithEvents(*writerIoBuffer, *readerIoBuffer, {{signal, writeValue}});
+    }
+}
+
 TEST_P(TestIoBuffer, WriteVariableSizedDataWithOnlyChangedLengthAndReceiveEventWithSharedMemory) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -543,10 +989,11 @@ TEST_P(TestIoBuffer, WriteVariableSizedDataWithOnlyChangedLengthAndReceiveEventW
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -575,10 +1022,11 @@ TEST_P(TestIoBuffer, NoNewEventIfVariableSizedDataDoesNotChangeWithSharedMemory)
     SwitchSignals(incomingSignals, outgoingSignals, coSimType);
 
     std::unique_ptr<IoBuffer> writerIoBuffer =
-        CreateIoBuffer(coSimType, connectionKind, name, incomingSignals, outgoingSignals);
+        CreateIoBuffer(coSimType, connectionKind, CoSimProtocolVersion, name, incomingSignals, outgoingSignals);
 
     std::unique_ptr<IoBuffer> readerIoBuffer = CreateIoBuffer(GetCounterPart(coSimType),
                                                               connectionKind,
+                                                              CoSimProtocolVersion,
                                                               GetCounterPart(name, connectionKind),
                                                               incomingSignals,
                                                               outgoingSignals);
@@ -1,5 +1,6 @@
 // Copyright dSPACE GmbH. All rights reserved.
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -29,19 +30,11 @@ protected:
             _senderChannel = ConnectToTcpChannel("127.0.0.1", port);
             _receiverChannel = Accept(*server);
         } else {
-#ifdef _WIN32
             const std::string name = GenerateString("LocalChannel名前");
             std::unique_ptr<ChannelServer> server = CreateLocalChannelServer(name);
 
             _senderChannel = ConnectToLocalChannel(name);
             _receiverChannel = Accept(*server);
-#else
-            const std::string name = GenerateString("UdsChannel名前");
-            std::unique_ptr<ChannelServer> server = CreateUdsChannelServer(name);
-
-            _senderChannel = ConnectToUdsChannel(name);
-            _receiverChannel = Accept(*server);
-#endif
         }
     }
 
@@ -306,15 +299,15 @@ TEST_P(TestProtocol, SendAndReceiveStep) {
 
     const std::string ioBufferName = GenerateString("IoBuffer名前");
     const std::unique_ptr<IoBuffer> clientIoBuffer =
-        CreateIoBuffer(CoSimType::Client, connectionKind, ioBufferName, {}, {});
+        CreateIoBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
     const std::unique_ptr<IoBuffer> serverIoBuffer =
-        CreateIoBuffer(CoSimType::Server, connectionKind, ioBufferName, {}, {});
+        CreateIoBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
 
     const std::string busBufferName = GenerateString("BusBuffer名前");
     const std::unique_ptr<BusBuffer> clientBusBuffer =
-        CreateBusBuffer(CoSimType::Client, connectionKind, busBufferName, {}, {}, {});
+        CreateBusBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
     const std::unique_ptr<BusBuffer> serverBusBuffer =
-        CreateBusBuffer(CoSimType::Server, connectionKind, busBufferName, {}, {}, {});
+        CreateBusBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
 
     // Act
     ASSERT_TRUE(Protocol::SendStep(_senderChannel->GetWriter(), sendSimulationTime, *clientIoBuffer, *clientBusBuffer));
@@ -331,6 +324,48 @@ TEST_P(TestProtocol, SendAndReceiveStep) {
     ASSERT_EQ(sendSimulationTime, receiveSimulationTime);
 }
 
+TEST_P(TestProtocol, SendAndReceiveStepN) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+    CustomSetUp(connectionKind);
+
+    const SimulationTime sendSimulationTime = GenerateSimulationTime();
+    const auto sendStepCount = GenerateU32();
+
+    const std::string ioBufferName = GenerateString("IoBuffer名前");
+    const std::unique_ptr<IoBuffer> clientIoBuffer =
+        CreateIoBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
+    const std::unique_ptr<IoBuffer> serverIoBuffer =
+        CreateIoBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
+
+    const std::string busBufferName = GenerateString("BusBuffer名前");
+    const std::unique_ptr<BusBuffer> clientBusBuffer =
+        CreateBusBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
+    const std::unique_ptr<BusBuffer> serverBusBuffer =
+        CreateBusBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
+
+    // Act
+    ASSERT_TRUE(Protocol::SendStepN(_senderChannel->GetWriter(),
+                                    sendSimulationTime,
+                                    sendStepCount,
+                                    *clientIoBuffer,
+                                    *clientBusBuffer));
+
+    // Assert
+    AssertFrame(FrameKind::StepN);
+
+    SimulationTime receiveSimulationTime{};
+    uint32_t receiveStepCount{};
+    ASSERT_TRUE(Protocol::ReadStepN(_receiverChannel->GetReader(),
+                                    receiveSimulationTime,
+                                    receiveStepCount,
+                                    *serverIoBuffer,
+                                    *serverBusBuffer,
+                                    {}));
+    ASSERT_EQ(sendSimulationTime, receiveSimulationTime);
+    ASSERT_EQ(sendStepCount, receiveStepCount);
+}
+
 TEST_P(TestProtocol, SendAndReceiveStepOk) {
     // Arrange
     const ConnectionKind connectionKind = GetParam();
@@ -342,18 +377,19 @@ TEST_P(TestProtocol, SendAndReceiveStepOk) {
 
     const std::string ioBufferName = GenerateString("IoBuffer名前");
     const std::unique_ptr<IoBuffer> clientIoBuffer =
-        CreateIoBuffer(CoSimType::Client, connectionKind, ioBufferName, {}, {});
+        CreateIoBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
     const std::unique_ptr<IoBuffer> serverIoBuffer =
-        CreateIoBuffer(CoSimType::Server, connectionKind, ioBufferName, {}, {});
+        CreateIoBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
 
     const std::string busBufferName = GenerateString("BusBuffer名前");
     const std::unique_ptr<BusBuffer> clientBusBuffer =
-        CreateBusBuffer(CoSimType::Client, connectionKind, busBufferName, {}, {}, {});
+        CreateBusBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
     const std::unique_ptr<BusBuffer> serverBusBuffer =
-        CreateBusBuffer(CoSimType::Server, connectionKind, busBufferName, {}, {}, {});
+        CreateBusBuffer(CoSimType::Server, connectionKind, CoSimProtocolVersion, busBufferName, {}, {}, {});
 
     // Act
     ASSERT_TRUE(Protocol::SendStepOk(_senderChannel->GetWriter(),
+                                     {},
                                      sendSimulationTime,
                                      sendCommand,
                                      *clientIoBuffer,
@@ -365,6 +401,7 @@ TEST_P(TestProtocol, SendAndReceiveStepOk) {
     SimulationTime receiveSimulationTime{};
     Command receiveCommand{};
     ASSERT_TRUE(Protocol::ReadStepOk(_receiverChannel->GetReader(),
+                                     {},
                                      receiveSimulationTime,
                                      receiveCommand,
                                      *serverIoBuffer,
@@ -373,6 +410,69 @@ TEST_P(TestProtocol, SendAndReceiveStepOk) {
     ASSERT_EQ(sendSimulationTime, receiveSimulationTime);
 }
 
+TEST_P(TestProtocol, SendStepOkWithBusTimestampRelativeToStepTime) {
+    // Arrange
+    const ConnectionKind connectionKind = GetParam();
+    CustomSetUp(connectionKind);
+
+    if (connectionKind == ConnectionKind::Local) {
+        GTEST_SKIP() << "Local connections keep the bus messages in shared memory.";
+    }
+
+    const SimulationTime stepSimulationTime = std::chrono::hours(1000);
+
+    const std::string ioBufferName = GenerateString("IoBuffer名前");
+    const std::unique_ptr<IoBuffer> clientIoBuffer =
+        CreateIoBuffer(CoSimType::Client, connectionKind, CoSimProtocolVersion, ioBufferName, {}, {});
+
+    CanControllerContainer controller{};
+    FillWithRandom(controller);
+    const std::string busBufferName = GenerateString("BusBuffer名前");
+    const std::unique_ptr<BusBuffer> clientBusBuffer = CreateBusBuffer(CoSimType::Client,
+                                                                       connectionKind,
+                                                                       CoSimProtocolVersion,
+                                                                       busBufferName,
+                                                                       {static_cast<CanController>(controller)},
+                                                                       {},
+                                                                       {});
+
+    CanMessageContainer message{};
+    FillWithRandom(message, controller.id);
+    message.timestamp = stepSimulationTime + SimulationTime(1);
+    ASSERT_TRUE(clientBusBuffer->Transmit(static_cast<CanMessage>(message)));
+
+    // Act
+    ASSERT_TRUE(Protocol::SendStepOk(_senderChannel->GetWriter(),
+                                     stepSimulationTime,
+                                     {},
+                                     Command::None,
+                                     *clientIoBuffer,
+                                     *clientBusBuffer));
+
+    // Assert
+    AssertFrame(FrameKind::StepOk);
+
+    ChannelReader& reader = _receiverChannel->GetReader();
+    SimulationTime receiveSimulationTime{};
+    ASSERT_TRUE(reader.Read(receiveSimulationTime));
+    Command receiveCommand{};
+    ASSERT_TRUE(reader.Read(receiveCommand));
+    uint32_t changedSignalCount{};
+    ASSERT_TRUE(reader.ReadVarint(changedSignalCount));
+    ASSERT_EQ(0U, changedSignalCount);
+    uint32_t messageCount{};
+    ASSERT_TRUE(reader.ReadVarint(messageCount));
+    ASSERT_EQ(1U, messageCount);
+    size_t controllerIndex{};
+    ASSERT_TRUE(reader.ReadVarint(controllerIndex));
+    ASSERT_EQ(0U, controllerIndex);
+
+    // One nanosecond after the step time is zigzag encoded as 2, which fits into a single byte
+    uint64_t timestamp{};
+    ASSERT_TRUE(reader.ReadVarint(timestamp));
+    ASSERT_EQ(2U, timestamp);
+}
+
 TEST_P(TestProtocol, SendAndReceiveGetPort) {
     // Arrange
     CustomSetUp(GetParam());